@@ -0,0 +1,206 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ChunkedFile.hpp"
+
+#include "Pipeline.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define OT_METHOD "opentxs::cli::ChunkedFile::"
+
+namespace
+{
+const std::string header_{"OT CHUNKED 1"};
+// Converted chunks are larger than CHUNK_SIZE, but not by this much. A
+// bigger record is corrupt and reading it would defeat the memory bound.
+const std::size_t max_record_{64 * 1024 * 1024};
+}  // namespace
+
+namespace opentxs::cli
+{
+const std::size_t ChunkedFile::CHUNK_SIZE{1024 * 1024};
+
+ChunkedFile::ChunkedFile(const Convert& convert, std::size_t depth)
+    : convert_(convert)
+    , depth_(std::max<std::size_t>(depth, 1))
+    , in_(0)
+    , out_(0)
+{
+}
+
+bool ChunkedFile::convert(std::vector<std::string>& chunks) const
+{
+    Pipeline pipeline(depth_);
+
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        pipeline.Add([&, i]() -> bool {
+            chunks[i] = convert_(chunks[i]);
+
+            return false == chunks[i].empty();
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+bool ChunkedFile::Pack(std::istream& in, std::ostream& out)
+{
+    in_ = 0;
+    out_ = 0;
+    out << header_ << '\n';
+    std::vector<std::string> chunks;
+
+    while (in.good()) {
+        chunks.clear();
+
+        while (in.good() && chunks.size() < depth_) {
+            std::string chunk(CHUNK_SIZE, '\0');
+            in.read(&chunk[0], CHUNK_SIZE);
+            chunk.resize(static_cast<std::size_t>(in.gcount()));
+
+            if (chunk.empty()) { break; }
+
+            const auto nul = chunk.find('\0');
+
+            if (std::string::npos != nul) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(": NUL byte at byte ")(
+                    in_ + nul)(", only text can be converted.")
+                    .Flush();
+
+                return false;
+            }
+
+            in_ += chunk.size();
+            chunks.push_back(std::move(chunk));
+        }
+
+        if (false == convert(chunks)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Cannot convert chunk.")
+                .Flush();
+
+            return false;
+        }
+
+        for (const auto& chunk : chunks) {
+            out << chunk.size() << '\n';
+            out.write(chunk.data(), chunk.size());
+            out << '\n';
+            out_ += chunk.size();
+        }
+
+        if (false == out.good()) { return false; }
+    }
+
+    return false == in.bad();
+}
+
+bool ChunkedFile::read_record(std::istream& in, std::string& record)
+{
+    std::string size;
+
+    if (false == std::getline(in, size).good() || size.empty() ||
+        size.size() > 9 ||
+        false == std::all_of(size.begin(), size.end(), [](char c) {
+            return 0 != std::isdigit(static_cast<unsigned char>(c));
+        })) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Bad record length at byte ")(
+            in_)(".")
+            .Flush();
+
+        return false;
+    }
+
+    const auto bytes = static_cast<std::size_t>(std::stoul(size));
+
+    if (max_record_ < bytes) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Record of ")(bytes)(
+            " bytes is too large.")
+            .Flush();
+
+        return false;
+    }
+
+    record.assign(bytes, '\0');
+    in.read(&record[0], bytes);
+
+    if (static_cast<std::size_t>(in.gcount()) != bytes || '\n' != in.get()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Truncated record at byte ")(
+            in_)(".")
+            .Flush();
+
+        return false;
+    }
+
+    in_ += size.size() + bytes + 2;
+
+    return true;
+}
+
+bool ChunkedFile::Unpack(std::istream& in, std::ostream& out)
+{
+    in_ = 0;
+    out_ = 0;
+    std::string line;
+
+    if (false == bool(std::getline(in, line))) { return false; }
+
+    if (header_ != line) {
+        // Not written by Pack(), so it can only be converted as a whole.
+        if (false == in.eof()) { line += '\n'; }
+
+        line.append(
+            std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+        in_ = line.size();
+        std::vector<std::string> whole{std::move(line)};
+
+        if (false == convert(whole)) { return false; }
+
+        out.write(whole[0].data(), whole[0].size());
+        out_ = whole[0].size();
+
+        return out.good();
+    }
+
+    in_ = line.size() + 1;
+    std::vector<std::string> chunks;
+
+    while (EOF != in.peek()) {
+        chunks.clear();
+
+        while (EOF != in.peek() && chunks.size() < depth_) {
+            std::string record;
+
+            if (false == read_record(in, record)) { return false; }
+
+            chunks.push_back(std::move(record));
+        }
+
+        if (false == convert(chunks)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Cannot convert record.")
+                .Flush();
+
+            return false;
+        }
+
+        for (const auto& chunk : chunks) {
+            out.write(chunk.data(), chunk.size());
+            out_ += chunk.size();
+        }
+
+        if (false == out.good()) { return false; }
+    }
+
+    return false == in.bad();
+}
+}  // namespace opentxs::cli
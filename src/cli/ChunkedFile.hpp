@@ -0,0 +1,69 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_CHUNKEDFILE_HPP
+#define OPENTXS_CLI_SRC_CLI_CHUNKEDFILE_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Runs a string conversion (encode, encrypt, ...) over a stream too large
+ *  to hold in memory.
+ *
+ *  Pack() cuts the input into CHUNK_SIZE pieces, converts each one and
+ *  writes the results as length prefixed records after a header line.
+ *  Unpack() reads such a file and writes the inverse conversion of every
+ *  record back to back; input without the header is converted as a whole,
+ *  so it also accepts the output of the interactive commands.
+ *
+ *  Up to depth chunks are converted in parallel, which bounds memory to
+ *  about depth times the chunk size in each direction.
+ *
+ *  Pack() only takes text. The client's conversions go through C strings
+ *  and would silently stop at a NUL byte, so input holding one fails. */
+class ChunkedFile
+{
+public:
+    typedef std::function<std::string(const std::string&)> Convert;
+
+    static const std::size_t CHUNK_SIZE;
+
+    /** Bytes read and written, valid after Pack() or Unpack(). */
+    EXPORT std::uint64_t BytesIn() const { return in_; }
+    EXPORT std::uint64_t BytesOut() const { return out_; }
+    /** A conversion returning "" counts as a failure. */
+    EXPORT bool Pack(std::istream& in, std::ostream& out);
+    EXPORT bool Unpack(std::istream& in, std::ostream& out);
+
+    EXPORT ChunkedFile(const Convert& convert, std::size_t depth);
+
+    EXPORT ~ChunkedFile() = default;
+
+private:
+    const Convert convert_;
+    const std::size_t depth_;
+    std::uint64_t in_;
+    std::uint64_t out_;
+
+    bool convert(std::vector<std::string>& chunks) const;
+    bool read_record(std::istream& in, std::string& record);
+
+    ChunkedFile() = delete;
+    ChunkedFile(const ChunkedFile&) = delete;
+    ChunkedFile(ChunkedFile&&) = delete;
+    ChunkedFile& operator=(const ChunkedFile&) = delete;
+    ChunkedFile& operator=(ChunkedFile&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_CHUNKEDFILE_HPP
@@ -0,0 +1,139 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "LatencyStats.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+
+#define OT_METHOD "opentxs::cli::LatencyStats::"
+
+namespace
+{
+double to_ms(std::chrono::microseconds value)
+{
+    return static_cast<double>(value.count()) / 1000.0;
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+LatencyStats::LatencyStats()
+    : lock_()
+    , samples_()
+    , sorted_(true)
+    , errors_(0)
+{
+}
+
+void LatencyStats::Add(Sample sample)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    samples_.push_back(sample);
+    sorted_ = false;
+}
+
+std::size_t LatencyStats::Count() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    return samples_.size();
+}
+
+void LatencyStats::Error()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    ++errors_;
+}
+
+std::size_t LatencyStats::Errors() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    return errors_;
+}
+
+bool LatencyStats::Measure(const std::function<bool()>& job)
+{
+    const auto start = std::chrono::steady_clock::now();
+    bool success{false};
+
+    try {
+        success = job();
+    } catch (const std::exception& e) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Job threw: ")(e.what()).Flush();
+    }
+
+    if (success) {
+        Add(std::chrono::duration_cast<Sample>(
+            std::chrono::steady_clock::now() - start));
+    } else {
+        Error();
+    }
+
+    return success;
+}
+
+LatencyStats::Sample LatencyStats::Percentile(double p) const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    return percentile(p);
+}
+
+LatencyStats::Sample LatencyStats::percentile(double p) const
+{
+    if (samples_.empty()) { return Sample(0); }
+
+    if (!sorted_) {
+        std::sort(samples_.begin(), samples_.end());
+        sorted_ = true;
+    }
+
+    // Nearest rank, so p100 is the maximum and p0 the minimum.
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(std::max(0.0, std::min(p, 100.0)) / 100.0 * samples_.size()));
+
+    return samples_[std::max<std::size_t>(rank, 1) - 1];
+}
+
+void LatencyStats::Write(
+    std::ostream& out,
+    const std::string& name,
+    std::chrono::milliseconds elapsed,
+    bool json) const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    const auto count = samples_.size();
+    const double seconds = static_cast<double>(elapsed.count()) / 1000.0;
+    const double rate = (0 < seconds) ? count / seconds : 0.0;
+    const auto p50 = to_ms(percentile(50));
+    const auto p90 = to_ms(percentile(90));
+    const auto p99 = to_ms(percentile(99));
+    const auto max = to_ms(percentile(100));
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    if (json) {
+        out << "{\"name\":\"" << name << "\",\"count\":" << count
+            << ",\"errors\":" << errors_ << ",\"elapsed_ms\":"
+            << elapsed.count() << ",\"ops_per_sec\":" << rate
+            << ",\"p50_ms\":" << p50 << ",\"p90_ms\":" << p90
+            << ",\"p99_ms\":" << p99 << ",\"max_ms\":" << max << "}";
+    } else {
+        out << name << ": " << count << " ok, " << errors_ << " errors in "
+            << elapsed.count() << " ms (" << rate << "/s); latency ms p50 "
+            << p50 << " p90 " << p90 << " p99 " << p99 << " max " << max;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+}  // namespace opentxs::cli
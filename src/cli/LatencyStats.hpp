@@ -0,0 +1,66 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_LATENCYSTATS_HPP
+#define OPENTXS_CLI_SRC_CLI_LATENCYSTATS_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Collects request latencies and summarizes them for the benchmark
+ *  commands.
+ *
+ *  Add() and Error() may be called concurrently from pipeline workers. Write()
+ *  prints either one line of text or one JSON object, so callers can combine
+ *  several phases into a single report. */
+class LatencyStats
+{
+public:
+    typedef std::chrono::microseconds Sample;
+
+    EXPORT void Add(Sample sample);
+    EXPORT std::size_t Count() const;
+    EXPORT void Error();
+    EXPORT std::size_t Errors() const;
+    /** Runs job, and records its latency if it returns true or an error if
+     *  it returns false or throws. Returns what job returned. */
+    EXPORT bool Measure(const std::function<bool()>& job);
+    /** p is in [0, 100]. Returns zero if there are no samples. */
+    EXPORT Sample Percentile(double p) const;
+    EXPORT void Write(
+        std::ostream& out,
+        const std::string& name,
+        std::chrono::milliseconds elapsed,
+        bool json) const;
+
+    EXPORT LatencyStats();
+
+    EXPORT ~LatencyStats() = default;
+
+private:
+    mutable std::mutex lock_;
+    // Sorted lazily, the first time a percentile is needed.
+    mutable std::vector<Sample> samples_;
+    mutable bool sorted_{true};
+    std::size_t errors_{0};
+
+    Sample percentile(double p) const;
+
+    LatencyStats(const LatencyStats&) = delete;
+    LatencyStats(LatencyStats&&) = delete;
+    LatencyStats& operator=(const LatencyStats&) = delete;
+    LatencyStats& operator=(LatencyStats&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_LATENCYSTATS_HPP
@@ -0,0 +1,381 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "MarketIndex.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include "opentxs.hpp"
+
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#define OT_METHOD "opentxs::cli::MarketIndex::"
+
+namespace
+{
+const char INDEX_MAGIC[8] = {'O', 'T', 'M', 'K', 'T', 'I', 'D', 'X'};
+const std::uint32_t INDEX_VERSION = 2;
+
+struct IndexHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t count;
+    // Size and mtime of the market_data.bin the index was built from.
+    std::uint64_t source_size;
+    std::int64_t source_time;
+};
+
+bool copy_id(char* dest, const std::string& src)
+{
+    if (src.size() >= opentxs::cli::MarketIndex::ID_SIZE) { return false; }
+
+    std::memset(dest, 0, opentxs::cli::MarketIndex::ID_SIZE);
+    std::memcpy(dest, src.data(), src.size());
+
+    return true;
+}
+
+std::int64_t to_int(const std::string& value)
+{
+    if (value.empty()) { return 0; }
+
+    return std::strtoll(value.c_str(), nullptr, 10);
+}
+
+bool same_id(const char* field, const std::string& id)
+{
+    return 0 == std::strncmp(
+                    field, id.c_str(), opentxs::cli::MarketIndex::ID_SIZE);
+}
+
+bool source_stamp(
+    const std::string& path,
+    std::uint64_t& size,
+    std::int64_t& time)
+{
+    struct stat info {};
+
+    if (0 != ::stat(path.c_str(), &info)) { return false; }
+
+    size = static_cast<std::uint64_t>(info.st_size);
+    time = static_cast<std::int64_t>(info.st_mtime);
+
+    return true;
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+MarketIndex::MarketIndex(const std::string& server)
+{
+    open(index_path(server), data_path(server));
+}
+
+const MarketIndex::Entry& MarketIndex::at(std::size_t index) const
+{
+    OT_ASSERT(nullptr != entries_);
+    OT_ASSERT(index < count_);
+
+    return entries_[index];
+}
+
+std::string MarketIndex::data_path(const std::string& server)
+{
+    return Opentxs::Client().DataFolder() + "/markets/" + server +
+           "/market_data.bin";
+}
+
+std::string MarketIndex::index_path(const std::string& server)
+{
+    return Opentxs::Client().DataFolder() + "/markets/" + server +
+           "/market_index.bin";
+}
+
+std::unique_ptr<OTDB::MarketList> MarketIndex::LoadMarketList(
+    const std::string& server)
+{
+    if (!OTDB::Exists(
+            Opentxs::Client().DataFolder(),
+            "markets",
+            server,
+            "market_data.bin",
+            "")) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": The market list file doesn't exist")
+            .Flush();
+        return nullptr;
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(
+        ": Markets file exists... Querying list of markets...")
+        .Flush();
+
+    std::unique_ptr<OTDB::Storable> storable{OTDB::QueryObject(
+        OTDB::STORED_OBJ_MARKET_LIST,
+        Opentxs::Client().DataFolder(),
+        "markets",
+        server,
+        "market_data.bin",
+        "")};
+    if (!storable) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Failed to verify storable object. "
+            "Probably doesn't exist.")
+            .Flush();
+        return nullptr;
+    }
+
+    auto* marketList = dynamic_cast<OTDB::MarketList*>(storable.get());
+    if (nullptr == marketList) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Unable to dynamic cast a storable to a marketlist.")
+            .Flush();
+        return nullptr;
+    }
+
+    storable.release();
+
+    return std::unique_ptr<OTDB::MarketList>{marketList};
+}
+
+bool MarketIndex::Matches(std::size_t index, const std::string& unit) const
+{
+    if (unit.empty()) { return true; }
+
+    const auto& entry = at(index);
+
+    return same_id(entry.market_id, unit) ||
+           same_id(entry.instrument_definition_id, unit) ||
+           same_id(entry.currency_type_id, unit);
+}
+
+void MarketIndex::open(const std::string& path, const std::string& source)
+{
+    const char* data{nullptr};
+    std::size_t size{0};
+
+#ifndef _WIN32
+    const int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (0 > fd) { return; }
+
+    struct stat info {};
+
+    if ((0 == ::fstat(fd, &info)) &&
+        (sizeof(IndexHeader) <= static_cast<std::size_t>(info.st_size))) {
+        void* map = ::mmap(
+            nullptr,
+            static_cast<std::size_t>(info.st_size),
+            PROT_READ,
+            MAP_SHARED,
+            fd,
+            0);
+
+        if (MAP_FAILED != map) {
+            map_ = map;
+            map_size_ = static_cast<std::size_t>(info.st_size);
+            data = static_cast<const char*>(map_);
+            size = map_size_;
+        }
+    }
+
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if (!file.good()) { return; }
+
+    buffer_.assign(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = buffer_.data();
+    size = buffer_.size();
+#endif
+
+    if ((nullptr == data) || (sizeof(IndexHeader) > size)) {
+        unmap();
+
+        return;
+    }
+
+    IndexHeader header{};
+    std::memcpy(&header, data, sizeof(header));
+    const bool valid =
+        (0 == std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC))) &&
+        (INDEX_VERSION == header.version) &&
+        (size == sizeof(IndexHeader) + header.count * sizeof(Entry));
+
+    if (!valid) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Ignoring invalid index file ")(
+            path)
+            .Flush();
+        unmap();
+
+        return;
+    }
+
+    std::uint64_t sourceSize{0};
+    std::int64_t sourceTime{0};
+    const bool current =
+        source_stamp(source, sourceSize, sourceTime) &&
+        (header.source_size == sourceSize) &&
+        (header.source_time == sourceTime);
+
+    if (!current) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Ignoring stale index file ")(
+            path)
+            .Flush();
+        unmap();
+
+        return;
+    }
+
+    count_ = header.count;
+    entries_ = reinterpret_cast<const Entry*>(data + sizeof(IndexHeader));
+}
+
+bool MarketIndex::Rebuild(const std::string& server)
+{
+    // Stamp the source before reading it: if it changes in between, the
+    // index comes out stale and is rebuilt next time, never the reverse.
+    std::uint64_t sourceSize{0};
+    std::int64_t sourceTime{0};
+
+    if (!source_stamp(data_path(server), sourceSize, sourceTime)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": The market list file doesn't exist")
+            .Flush();
+        return false;
+    }
+
+    auto marketList = LoadMarketList(server);
+
+    if (!marketList) { return false; }
+
+    return write(server, *marketList, sourceSize, sourceTime);
+}
+
+void MarketIndex::unmap()
+{
+#ifndef _WIN32
+    if (nullptr != map_) { ::munmap(map_, map_size_); }
+#endif
+
+    map_ = nullptr;
+    map_size_ = 0;
+    buffer_.clear();
+    entries_ = nullptr;
+    count_ = 0;
+}
+
+bool MarketIndex::write(
+    const std::string& server,
+    OTDB::MarketList& marketList,
+    std::uint64_t sourceSize,
+    std::int64_t sourceTime)
+{
+    const std::int32_t items = marketList.GetMarketDataCount();
+
+    if (0 > items) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot load market list item count.")
+            .Flush();
+        return false;
+    }
+
+    IndexHeader header{};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version = INDEX_VERSION;
+    header.count = static_cast<std::uint32_t>(items);
+    header.source_size = sourceSize;
+    header.source_time = sourceTime;
+
+    std::string output(sizeof(IndexHeader) + items * sizeof(Entry), '\0');
+    std::memcpy(&output[0], &header, sizeof(header));
+
+    for (std::int32_t i = 0; i < items; i++) {
+        OTDB::MarketData* marketData = marketList.GetMarketData(i);
+
+        if (nullptr == marketData) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: cannot load market data at index ")(i)
+                .Flush();
+            return false;
+        }
+
+        Entry entry{};
+        const bool copied =
+            copy_id(entry.market_id, marketData->market_id) &&
+            copy_id(
+                entry.instrument_definition_id,
+                marketData->instrument_definition_id) &&
+            copy_id(entry.currency_type_id, marketData->currency_type_id);
+
+        if (!copied) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: market ID too long at index ")(i)
+                .Flush();
+            return false;
+        }
+
+        entry.scale = to_int(marketData->scale);
+        entry.last_sale_price = to_int(marketData->last_sale_price);
+        entry.volume_assets = to_int(marketData->volume_assets);
+        entry.volume_currency = to_int(marketData->volume_currency);
+        std::memcpy(
+            &output[sizeof(IndexHeader) + i * sizeof(Entry)],
+            &entry,
+            sizeof(entry));
+    }
+
+    // Write next to the real file and rename over it so a concurrent reader
+    // never maps a partially written index.
+    const auto path = index_path(server);
+    const auto temp = path + ".tmp";
+
+    {
+        std::ofstream file(
+            temp, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(output.data(), output.size());
+
+        if (!file.good()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot write ")(temp)
+                .Flush();
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+
+    if (0 != std::rename(temp.c_str(), path.c_str())) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot replace ")(path)
+            .Flush();
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Indexed ")(items)(" markets.")
+        .Flush();
+
+    return true;
+}
+
+MarketIndex::~MarketIndex() { unmap(); }
+}  // namespace opentxs::cli
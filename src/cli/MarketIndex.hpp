@@ -0,0 +1,85 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_MARKETINDEX_HPP
+#define OPENTXS_CLI_SRC_CLI_MARKETINDEX_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Compact, fixed-width copy of a notary's market list.
+ *
+ *  The serialized OTDB::MarketList at markets/<server>/market_data.bin has to
+ *  be fully deserialized (and freed) every time it is read. MarketIndex keeps
+ *  only the fields the CLI displays or filters on, in a flat file next to it
+ *  (markets/<server>/market_index.bin) which is memory-mapped for reading.
+ *  The index is rewritten by getmarkets whenever the list is downloaded, and
+ *  records the size and modification time of the market_data.bin it was
+ *  built from. Once those no longer match the index is treated as invalid,
+ *  so a list written by anything else gets indexed again. */
+class MarketIndex
+{
+public:
+    static const std::size_t ID_SIZE = 96;
+
+    struct Entry {
+        char market_id[ID_SIZE];
+        char instrument_definition_id[ID_SIZE];
+        char currency_type_id[ID_SIZE];
+        std::int64_t scale;
+        std::int64_t last_sale_price;
+        std::int64_t volume_assets;
+        std::int64_t volume_currency;
+    };
+
+    /** Deserializes market_data.bin for the given notary. The caller owns
+     *  the result. Returns nullptr if the file doesn't exist or is invalid. */
+    EXPORT static std::unique_ptr<OTDB::MarketList> LoadMarketList(
+        const std::string& server);
+    /** Regenerates market_index.bin from market_data.bin. */
+    EXPORT static bool Rebuild(const std::string& server);
+
+    EXPORT bool IsValid() const { return nullptr != entries_; }
+    EXPORT bool Matches(std::size_t index, const std::string& unit) const;
+    EXPORT std::size_t size() const { return count_; }
+    EXPORT const Entry& at(std::size_t index) const;
+
+    EXPORT explicit MarketIndex(const std::string& server);
+
+    EXPORT ~MarketIndex();
+
+private:
+    void* map_{nullptr};
+    std::size_t map_size_{0};
+    std::vector<char> buffer_;
+    const Entry* entries_{nullptr};
+    std::size_t count_{0};
+
+    static std::string data_path(const std::string& server);
+    static std::string index_path(const std::string& server);
+    static bool write(
+        const std::string& server,
+        OTDB::MarketList& marketList,
+        std::uint64_t sourceSize,
+        std::int64_t sourceTime);
+
+    void open(const std::string& path, const std::string& source);
+    void unmap();
+
+    MarketIndex() = delete;
+    MarketIndex(const MarketIndex&) = delete;
+    MarketIndex(MarketIndex&&) = delete;
+    MarketIndex& operator=(const MarketIndex&) = delete;
+    MarketIndex& operator=(MarketIndex&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_MARKETINDEX_HPP
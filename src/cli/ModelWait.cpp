@@ -0,0 +1,99 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ModelWait.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+
+#define OT_METHOD "opentxs::cli::ModelWait::"
+
+namespace opentxs::cli
+{
+const std::chrono::milliseconds ModelWait::settle_{50};
+
+ModelWait::ModelWait(
+    const api::client::Manager& client,
+    const Identifier& widget)
+    : widget_(widget.str())
+    , start_(std::chrono::steady_clock::now())
+    , lock_()
+    , updated_()
+    , updates_(0)
+    , elapsed_(0)
+    , callback_(network::zeromq::ListenCallback::Factory(
+          [this](const network::zeromq::Message& message) -> void {
+              this->update(message);
+          }))
+    , socket_(client.ZeroMQ().SubscribeSocket(callback_))
+{
+    const auto endpoint = client.Endpoints().WidgetUpdate();
+
+    if (false == socket_->Start(endpoint)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Failed to subscribe to ")(
+            endpoint)
+            .Flush();
+    }
+}
+
+void ModelWait::update(const network::zeromq::Message& message)
+{
+    if (0 == message.Body().size()) { return; }
+
+    const std::string widget{message.Body_at(0)};
+
+    if (widget != widget_) { return; }
+
+    std::lock_guard<std::mutex> lock(lock_);
+    ++updates_;
+    updated_.notify_all();
+}
+
+bool ModelWait::Wait(const Ready& ready, std::chrono::milliseconds timeout)
+{
+    const auto deadline = start_ + timeout;
+    std::unique_lock<std::mutex> lock(lock_);
+    bool output{false};
+
+    while (true) {
+        const auto seen = updates_;
+        const auto changed = [&]() -> bool { return seen != updates_; };
+        // The model takes its own locks while it is being read, so don't
+        // hold ours across the check.
+        lock.unlock();
+        output = ready();
+        lock.lock();
+
+        // A model with nothing in it never passes ready(), but once it has
+        // published something and then gone quiet it is done loading too.
+        if (output || 0 < updates_) {
+            const auto until = std::min(
+                std::chrono::steady_clock::now() + settle_, deadline);
+
+            if (false == updated_.wait_until(lock, until, changed)) {
+                output = output || (until < deadline);
+                break;
+            }
+        } else if (false == updated_.wait_until(lock, deadline, changed)) {
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            lock.unlock();
+            output = ready();
+            lock.lock();
+            break;
+        }
+    }
+
+    elapsed_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_);
+
+    return output;
+}
+
+ModelWait::~ModelWait() { socket_->Close(); }
+}  // namespace opentxs::cli
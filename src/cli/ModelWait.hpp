@@ -0,0 +1,71 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_MODELWAIT_HPP
+#define OPENTXS_CLI_SRC_CLI_MODELWAIT_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace opentxs::cli
+{
+/** Waits for an asynchronous UI model (ContactList, ActivitySummary, ...) to
+ *  finish loading.
+ *
+ *  The models fill themselves in on background threads and publish the
+ *  widget ID on the WidgetUpdate endpoint every time they change. A
+ *  ModelWait subscribes to that endpoint as soon as it is constructed and
+ *  Wait() sleeps until a notification for its widget arrives, so nothing is
+ *  polled. The model counts as loaded once the caller's ready() check passes,
+ *  or it has published at least one update, and it has then stopped changing
+ *  for a short settle period. The second case covers models that are empty.
+ *  An empty model that finished before the subscription never notifies, so
+ *  callers that can tell from storage that there is nothing to load should
+ *  say so in ready(). */
+class ModelWait
+{
+public:
+    typedef std::function<bool()> Ready;
+
+    /** Time from construction until Wait() returned. */
+    EXPORT std::chrono::milliseconds Elapsed() const { return elapsed_; }
+    /** Returns false if the model had not loaded before the timeout. */
+    EXPORT bool Wait(const Ready& ready, std::chrono::milliseconds timeout);
+
+    EXPORT ModelWait(
+        const api::client::Manager& client,
+        const Identifier& widget);
+
+    EXPORT ~ModelWait();
+
+private:
+    // Updates closer together than this are part of the same load.
+    static const std::chrono::milliseconds settle_;
+
+    const std::string widget_;
+    const std::chrono::steady_clock::time_point start_;
+    std::mutex lock_;
+    std::condition_variable updated_;
+    std::uint64_t updates_;
+    std::chrono::milliseconds elapsed_;
+    OTZMQListenCallback callback_;
+    OTZMQSubscribeSocket socket_;
+
+    void update(const network::zeromq::Message& message);
+
+    ModelWait() = delete;
+    ModelWait(const ModelWait&) = delete;
+    ModelWait(ModelWait&&) = delete;
+    ModelWait& operator=(const ModelWait&) = delete;
+    ModelWait& operator=(ModelWait&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_MODELWAIT_HPP
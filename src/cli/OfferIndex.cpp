@@ -0,0 +1,144 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OfferIndex.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#define OT_METHOD "opentxs::cli::OfferIndex::"
+
+namespace
+{
+std::int64_t to_int(const std::string& value)
+{
+    if (value.empty()) { return 0; }
+
+    return std::strtoll(value.c_str(), nullptr, 10);
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+OfferIndex::OfferIndex(OTDB::OfferListNym& offerList)
+    : books_()
+    , size_(0)
+{
+    const std::int32_t items = offerList.GetOfferDataNymCount();
+
+    for (std::int32_t i = 0; i < items; ++i) {
+        OTDB::OfferDataNym* offerData = offerList.GetOfferDataNym(i);
+
+        if (nullptr == offerData) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Unable to reference (nym) offerData on offerList, at "
+                "index: ")(i)
+                .Flush();
+            continue;
+        }
+
+        Offer offer;
+        offer.number = to_int(offerData->transaction_id);
+        offer.asset_acct_id = offerData->asset_acct_id;
+        offer.currency_acct_id = offerData->currency_acct_id;
+        offer.instrument_definition_id = offerData->instrument_definition_id;
+        offer.currency_type_id = offerData->currency_type_id;
+        offer.scale = to_int(offerData->scale);
+        offer.price = to_int(offerData->price_per_scale);
+        offer.available = to_int(offerData->total_assets) -
+                          to_int(offerData->finished_so_far);
+        offer.selling = offerData->selling;
+
+        auto& book = books_[BookKey{
+            offer.asset_acct_id, offer.currency_acct_id, offer.scale}];
+        auto& side = offer.selling ? book.asks_ : book.bids_;
+        const auto price = offer.price;
+        side.emplace(price, std::move(offer));
+        ++size_;
+    }
+}
+
+OfferIndex::Offers OfferIndex::Crossing(
+    const std::string& assetAcct,
+    const std::string& currencyAcct,
+    std::int64_t scale,
+    bool selling,
+    std::int64_t price) const
+{
+    Offers output;
+    const auto it = books_.find(BookKey{assetAcct, currencyAcct, scale});
+
+    if (books_.end() == it) { return output; }
+
+    const auto& book = it->second;
+
+    if (selling) {
+        // Don't leave an old bid lying around above the price we're now
+        // selling at.
+        for (auto bid = book.bids_.upper_bound(price); bid != book.bids_.end();
+             ++bid) {
+            output.push_back(&bid->second);
+        }
+    } else {
+        // Don't buy high and then have an old ask sell low.
+        const auto end = book.asks_.lower_bound(price);
+
+        for (auto ask = book.asks_.begin(); ask != end; ++ask) {
+            output.push_back(&ask->second);
+        }
+    }
+
+    return output;
+}
+
+OfferIndex::Offers OfferIndex::Select(
+    const std::string& assetAcct,
+    const std::string& currencyAcct,
+    const std::string& side,
+    std::int64_t minPrice,
+    std::int64_t maxPrice) const
+{
+    Offers output;
+
+    for (const auto& it : books_) {
+        const auto& key = it.first;
+        const auto& book = it.second;
+
+        if (!assetAcct.empty() && assetAcct != std::get<0>(key)) { continue; }
+
+        if (!currencyAcct.empty() && currencyAcct != std::get<1>(key)) {
+            continue;
+        }
+
+        if ("ask" != side) {
+            select_range(book.bids_, minPrice, maxPrice, output);
+        }
+
+        if ("bid" != side) {
+            select_range(book.asks_, minPrice, maxPrice, output);
+        }
+    }
+
+    return output;
+}
+
+void OfferIndex::select_range(
+    const Side& side,
+    std::int64_t minPrice,
+    std::int64_t maxPrice,
+    Offers& output)
+{
+    if (minPrice > maxPrice) { return; }
+
+    const auto end = side.upper_bound(maxPrice);
+
+    for (auto it = side.lower_bound(minPrice); it != end; ++it) {
+        output.push_back(&it->second);
+    }
+}
+}  // namespace opentxs::cli
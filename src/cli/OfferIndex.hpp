@@ -0,0 +1,91 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_OFFERINDEX_HPP
+#define OPENTXS_CLI_SRC_CLI_OFFERINDEX_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Price-ordered view of a nym's offers (OTDB::OfferListNym).
+ *
+ *  Offers are grouped into books keyed by asset account, currency account and
+ *  scale (the same "market" that showmyoffers groups by), and each book keeps
+ *  its bids and asks ordered by price, so range queries don't have to scan
+ *  every offer the nym has. */
+class OfferIndex
+{
+public:
+    struct Offer {
+        TransactionNumber number{0};
+        std::string asset_acct_id;
+        std::string currency_acct_id;
+        std::string instrument_definition_id;
+        std::string currency_type_id;
+        std::int64_t scale{0};
+        std::int64_t price{0};
+        std::int64_t available{0};
+        bool selling{false};
+    };
+
+    typedef std::vector<const Offer*> Offers;
+
+    /** Offers the nym already has on the same accounts and scale which a new
+     *  offer at this price would trade against: for a new bid, asks priced
+     *  below it; for a new ask, bids priced above it. */
+    EXPORT Offers Crossing(
+        const std::string& assetAcct,
+        const std::string& currencyAcct,
+        std::int64_t scale,
+        bool selling,
+        std::int64_t price) const;
+    /** Offers whose price lies within [minPrice, maxPrice]. An empty account
+     *  matches every book; side is "bid", "ask" or empty for both. */
+    EXPORT Offers Select(
+        const std::string& assetAcct,
+        const std::string& currencyAcct,
+        const std::string& side,
+        std::int64_t minPrice,
+        std::int64_t maxPrice) const;
+    EXPORT std::size_t size() const { return size_; }
+
+    EXPORT explicit OfferIndex(OTDB::OfferListNym& offerList);
+
+    EXPORT ~OfferIndex() = default;
+
+private:
+    typedef std::tuple<std::string, std::string, std::int64_t> BookKey;
+    typedef std::multimap<std::int64_t, Offer> Side;
+
+    struct Book {
+        Side bids_;
+        Side asks_;
+    };
+
+    std::map<BookKey, Book> books_;
+    std::size_t size_{0};
+
+    static void select_range(
+        const Side& side,
+        std::int64_t minPrice,
+        std::int64_t maxPrice,
+        Offers& output);
+
+    OfferIndex() = delete;
+    OfferIndex(const OfferIndex&) = delete;
+    OfferIndex(OfferIndex&&) = delete;
+    OfferIndex& operator=(const OfferIndex&) = delete;
+    OfferIndex& operator=(OfferIndex&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_OFFERINDEX_HPP
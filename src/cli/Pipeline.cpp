@@ -0,0 +1,89 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Pipeline.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define OT_METHOD "opentxs::cli::Pipeline::"
+
+namespace opentxs::cli
+{
+Pipeline::Pipeline(std::size_t depth)
+    : depth_(std::max<std::size_t>(depth, 1))
+    , jobs_()
+    , results_()
+{
+}
+
+std::size_t Pipeline::Add(Job job)
+{
+    jobs_.emplace_back(std::move(job));
+
+    return jobs_.size() - 1;
+}
+
+std::size_t Pipeline::Run(const Progress& progress)
+{
+    const auto total = jobs_.size();
+    results_.assign(total, 0);
+
+    if (0 == total) { return 0; }
+
+    std::atomic<std::size_t> next{0};
+    std::mutex lock;
+    std::size_t done{0};
+    std::size_t failed{0};
+
+    auto worker = [&]() {
+        for (auto i = next++; i < total; i = next++) {
+            bool success{false};
+
+            try {
+                success = jobs_[i]();
+            } catch (const std::exception& e) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(": Job ")(i)(" threw: ")(
+                    e.what())
+                    .Flush();
+            }
+
+            results_[i] = success ? 1 : 0;
+
+            std::lock_guard<std::mutex> guard(lock);
+            ++done;
+
+            if (!success) { ++failed; }
+
+            if (progress) { progress(done, failed, total); }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto count = std::min(depth_, total);
+
+    for (std::size_t i = 1; i < count; ++i) { threads.emplace_back(worker); }
+
+    worker();
+
+    for (auto& thread : threads) { thread.join(); }
+
+    return failed;
+}
+
+bool Pipeline::Succeeded(std::size_t index) const
+{
+    if (index >= results_.size()) { return false; }
+
+    return 1 == results_[index];
+}
+}  // namespace opentxs::cli
@@ -0,0 +1,54 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_PIPELINE_HPP
+#define OPENTXS_CLI_SRC_CLI_PIPELINE_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Runs a batch of independent jobs with a bounded number in flight.
+ *
+ *  Bulk commands queue one job per server request (or per unit of CPU work)
+ *  and call Run(), which blocks until every job has finished. A job reports
+ *  success by returning true; a job that throws counts as failed. */
+class Pipeline
+{
+public:
+    typedef std::function<bool()> Job;
+    /** Called after each job finishes, serialized across workers. */
+    typedef std::function<
+        void(std::size_t done, std::size_t failed, std::size_t total)>
+        Progress;
+
+    EXPORT std::size_t Add(Job job);
+    /** Returns the number of failed jobs. */
+    EXPORT std::size_t Run(const Progress& progress = Progress());
+    EXPORT std::size_t size() const { return jobs_.size(); }
+    /** Valid after Run(). */
+    EXPORT bool Succeeded(std::size_t index) const;
+
+    EXPORT explicit Pipeline(std::size_t depth);
+
+    EXPORT ~Pipeline() = default;
+
+private:
+    const std::size_t depth_;
+    std::vector<Job> jobs_;
+    std::vector<char> results_;
+
+    Pipeline() = delete;
+    Pipeline(const Pipeline&) = delete;
+    Pipeline(Pipeline&&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+    Pipeline& operator=(Pipeline&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_PIPELINE_HPP
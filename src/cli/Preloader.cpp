@@ -0,0 +1,198 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Preloader.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <set>
+#include <utility>
+
+#define OT_METHOD "opentxs::cli::Preloader::"
+
+namespace opentxs::cli
+{
+Preloader::Preloader(const api::client::Manager& client)
+    : client_(client)
+    , lock_()
+    , wake_()
+    , queue_()
+    , threads_()
+    , settings_()
+    , sequence_(0)
+    , active_(0)
+    , done_(0)
+    , cancelled_(false)
+{
+}
+
+void Preloader::Cancel()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    cancelled_ = true;
+    queue_ = decltype(queue_)();
+    wake_.notify_all();
+}
+
+void Preloader::join()
+{
+    for (auto& thread : threads_) {
+        if (thread.joinable()) { thread.join(); }
+    }
+
+    threads_.clear();
+}
+
+void Preloader::plan()
+{
+    const auto items = settings_.items_;
+
+    for (std::int32_t i = 0; i < SwigWrap::GetNymCount(); ++i) {
+        const auto mynym = SwigWrap::GetNym_ID(i);
+        const auto nymID = Identifier::Factory(mynym);
+        schedule(ACTIVITY, [this, mynym, items]() {
+            client_.Activity().PreloadActivity(
+                Identifier::Factory(mynym), items);
+        });
+
+        std::set<std::string> unread;
+
+        for (const auto& it : client_.Activity().Threads(nymID, true)) {
+            const auto& thread = it.first;
+            unread.insert(thread);
+            schedule(UNREAD_THREADS, [this, mynym, thread, items]() {
+                client_.Activity().PreloadThread(
+                    Identifier::Factory(mynym),
+                    Identifier::Factory(thread),
+                    0,
+                    items);
+            });
+        }
+
+        // Constructing a model is enough to start it loading.
+        schedule(MODELS, [this, mynym]() {
+            const auto nymID = Identifier::Factory(mynym);
+            client_.UI().ContactList(nymID);
+            client_.UI().ActivitySummary(nymID);
+        });
+
+        for (const auto& it : client_.Activity().Threads(nymID, false)) {
+            const auto& thread = it.first;
+
+            if (1 == unread.count(thread)) { continue; }
+
+            schedule(THREADS, [this, mynym, thread, items]() {
+                client_.Activity().PreloadThread(
+                    Identifier::Factory(mynym),
+                    Identifier::Factory(thread),
+                    0,
+                    items);
+            });
+        }
+    }
+
+    for (const auto& it : client_.Storage().AccountList()) {
+        const auto myacct = it.first;
+        schedule(BOXES, [myacct]() {
+            const auto server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+            const auto mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+
+            if ("" == server || "" == mynym) { return; }
+
+            SwigWrap::LoadInbox(server, mynym, myacct);
+            SwigWrap::LoadOutbox(server, mynym, myacct);
+        });
+    }
+}
+
+Preloader::Status Preloader::Progress() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    Status output;
+    output.running_ = (0 < active_) || (false == queue_.empty());
+    output.cancelled_ = cancelled_;
+    output.done_ = done_;
+    output.pending_ = active_ + queue_.size();
+
+    return output;
+}
+
+void Preloader::schedule(Priority priority, Job job)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    if (cancelled_) { return; }
+
+    queue_.emplace(priority, sequence_++, std::move(job));
+    wake_.notify_one();
+}
+
+bool Preloader::Start(const Settings& settings)
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+
+        if ((0 < active_) || (false == queue_.empty())) { return false; }
+    }
+
+    // Reap the workers of an earlier run, which have all exited by now.
+    join();
+    std::lock_guard<std::mutex> lock(lock_);
+    settings_ = settings;
+    cancelled_ = false;
+    done_ = 0;
+    queue_.emplace(PLAN, sequence_++, [this]() { plan(); });
+
+    for (std::size_t i = 0; i < std::max<std::size_t>(settings_.threads_, 1);
+         ++i) {
+        threads_.emplace_back(&Preloader::worker, this);
+    }
+
+    return true;
+}
+
+void Preloader::worker()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (true) {
+        // An empty queue with nothing running means the last job didn't
+        // schedule anything else, so the preload is finished.
+        wake_.wait(lock, [&]() -> bool {
+            return cancelled_ || (false == queue_.empty()) || (0 == active_);
+        });
+
+        if (cancelled_ || queue_.empty()) { break; }
+
+        auto job = std::get<2>(queue_.top());
+        queue_.pop();
+        ++active_;
+        lock.unlock();
+
+        try {
+            job();
+        } catch (const std::exception& e) {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Preload job threw: ")(
+                e.what())
+                .Flush();
+        }
+
+        lock.lock();
+        --active_;
+        ++done_;
+        wake_.notify_all();
+        wake_.wait_for(
+            lock, settings_.pause_, [&]() -> bool { return cancelled_; });
+    }
+}
+
+Preloader::~Preloader()
+{
+    Cancel();
+    join();
+}
+}  // namespace opentxs::cli
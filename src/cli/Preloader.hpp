@@ -0,0 +1,110 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_PRELOADER_HPP
+#define OPENTXS_CLI_SRC_CLI_PRELOADER_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace opentxs::cli
+{
+/** Warms the client's caches in the background, most useful data first.
+ *
+ *  Start() queues a planning job which looks at the wallet and queues one
+ *  job per piece of work, in priority order:
+ *
+ *    1. Activity().PreloadActivity() for every local nym
+ *    2. threads with unread items (the ones about to be opened)
+ *    3. the contact list and activity summary UI models
+ *    4. every account's inbox and outbox
+ *    5. all remaining threads
+ *
+ *  The jobs run on a small number of worker threads with a pause after each
+ *  one, so an interactive session started at the same time stays
+ *  responsive. Cancel() drops whatever hasn't started yet. */
+class Preloader
+{
+public:
+    struct Settings {
+        std::size_t threads_{2};
+        std::chrono::milliseconds pause_{10};
+        // Messages per thread.
+        std::size_t items_{10};
+    };
+
+    struct Status {
+        bool running_{false};
+        bool cancelled_{false};
+        std::size_t done_{0};
+        std::size_t pending_{0};
+    };
+
+    EXPORT void Cancel();
+    /** Returns false if a preload is already running. */
+    EXPORT bool Start(const Settings& settings);
+    EXPORT Status Progress() const;
+
+    EXPORT explicit Preloader(const api::client::Manager& client);
+
+    EXPORT ~Preloader();
+
+private:
+    enum Priority : std::uint8_t {
+        PLAN = 0,
+        ACTIVITY = 1,
+        UNREAD_THREADS = 2,
+        MODELS = 3,
+        BOXES = 4,
+        THREADS = 5,
+    };
+
+    typedef std::function<void()> Job;
+    // Priority, then order of scheduling, so equal priorities run FIFO.
+    typedef std::tuple<Priority, std::uint64_t, Job> Entry;
+
+    struct Later {
+        bool operator()(const Entry& lhs, const Entry& rhs) const
+        {
+            return std::tie(std::get<0>(lhs), std::get<1>(lhs)) >
+                   std::tie(std::get<0>(rhs), std::get<1>(rhs));
+        }
+    };
+
+    const api::client::Manager& client_;
+    mutable std::mutex lock_;
+    std::condition_variable wake_;
+    std::priority_queue<Entry, std::vector<Entry>, Later> queue_;
+    std::vector<std::thread> threads_;
+    Settings settings_;
+    std::uint64_t sequence_;
+    std::size_t active_;
+    std::size_t done_;
+    bool cancelled_;
+
+    void join();
+    void plan();
+    void schedule(Priority priority, Job job);
+    void worker();
+
+    Preloader() = delete;
+    Preloader(const Preloader&) = delete;
+    Preloader(Preloader&&) = delete;
+    Preloader& operator=(const Preloader&) = delete;
+    Preloader& operator=(Preloader&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_PRELOADER_HPP
@@ -5,17 +5,23 @@
 
 #include "RecordList.hpp"
 
+#include "Stats.hpp"
+#include "TransactionNumberPool.hpp"
+
 #include <opentxs/opentxs.hpp>
 #include <opentxs/client/Helpers.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::RecordList"
 
@@ -46,6 +52,70 @@ const std::string& GetTypeString(int theType)
     return Instrument_TypeStrings[theType];
 }
 
+bool parse_index(
+    const std::string& text,
+    std::string::size_type& pos,
+    std::int64_t& value)
+{
+    const auto start = pos;
+    value = 0;
+
+    for (; pos < text.length() && isdigit(text[pos]); pos++) {
+        value = value * 10 + text[pos] - '0';
+
+        if (value > std::numeric_limits<std::int32_t>::max()) { return false; }
+    }
+
+    return pos > start;
+}
+
+// One entry of an indices list: either "N" or "N-M", with N <= M.
+bool parse_index_range(
+    const std::string& entry,
+    std::int64_t& first,
+    std::int64_t& last)
+{
+    std::string::size_type pos{0};
+
+    if (!parse_index(entry, pos, first)) { return false; }
+
+    last = first;
+
+    if (pos < entry.length() && '-' == entry[pos]) {
+        pos++;
+
+        if (!parse_index(entry, pos, last)) { return false; }
+    }
+
+    return entry.length() == pos && first <= last;
+}
+
+// Calls visit(first, last) for each comma-separated entry of an indices list.
+// Stops and returns false at the first entry that isn't a value or a range,
+// or as soon as visit returns false.
+template <typename Visitor>
+bool for_each_index_range(const std::string& indices, Visitor visit)
+{
+    for (std::string::size_type pos = 0; pos <= indices.length();) {
+        auto end = indices.find(',', pos);
+
+        if (std::string::npos == end) { end = indices.length(); }
+
+        std::int64_t first{0};
+        std::int64_t last{0};
+
+        if (!parse_index_range(indices.substr(pos, end - pos), first, last)) {
+            return false;
+        }
+
+        if (!visit(first, last)) { return false; }
+
+        pos = end + 1;
+    }
+
+    return true;
+}
+
 }  // namespace
 
 namespace opentxs::cli
@@ -74,6 +144,10 @@ RecordList::RecordList()
 
 const std::string RecordList::s_blank("");
 const std::string RecordList::s_message_type("message");
+// Receipts accepted per processInbox message. Each one adds a response item
+// to the signed ledger, so very large selections are split to keep every
+// message comfortably under the notary's size limit.
+const std::size_t RecordList::INBOX_RESPONSES_PER_MESSAGE{500};
 
 std::string RecordList::s_strTextTo(MC_UI_TEXT_TO);      // "To: %s"
 std::string RecordList::s_strTextFrom(MC_UI_TEXT_FROM);  // "From: %s"
@@ -172,22 +246,51 @@ bool RecordList::checkIndicesRange(  // static method
     const std::string& indices,
     std::int32_t items)
 {
-    if ("all" == indices) { return true; }
+    std::vector<bool> selected;
 
-    for (std::string::size_type i = 0; i < indices.length(); i++) {
-        std::int32_t value = 0;
-        for (; isdigit(indices[i]); i++) {
-            value = value * 10 + indices[i] - '0';
-        }
-        if (0 > value || value >= items) {
-            LogNormal(OT_METHOD)(__FUNCTION__)(":  Error: ")(name)(": value (")(
-                value)(") out of range (must be < ")(items)(").")
-                .Flush();
-            return false;
-        }
+    return parse_indices(name, indices, items, selected);
+}
+
+// Parses an indices list ("all", or values and ranges such as "3,7,10-19")
+// once into one flag per item, so callers can test each index directly
+// instead of searching the list for it.
+//
+bool RecordList::parse_indices(  // static method
+    const char* name,
+    const std::string& indices,
+    std::int32_t items,
+    std::vector<bool>& selected)
+{
+    const bool all = ("" == indices || "all" == indices);
+    selected.assign(std::max<std::int32_t>(items, 0), all);
+
+    if (all) { return true; }
+
+    bool inRange{true};
+    const bool valid = for_each_index_range(
+        indices, [&](std::int64_t first, std::int64_t last) -> bool {
+            if (last >= items) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(":  Error: ")(name)(
+                    ": value (")(last)(") out of range (must be < ")(items)(
+                    ").")
+                    .Flush();
+                inRange = false;
+
+                return false;
+            }
+
+            for (auto i = first; i <= last; i++) { selected[i] = true; }
+
+            return true;
+        });
+
+    if (!valid && inRange) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
+            ": not a value: ")(indices)(".")
+            .Flush();
     }
 
-    return true;
+    return valid;
 }
 
 // GET PAYMENT INSTRUMENT (from payments inbox, by index.)
@@ -242,12 +345,78 @@ std::string RecordList::get_payment_instrument(  // static method
     return strInstrument;
 }
 
+bool RecordList::load_payment_inbox(  // static method
+    const std::string& transport_notary,
+    const std::string& mynym,
+    PaymentItems& items)
+{
+    items.clear();
+    const auto theNotaryID = Identifier::Factory(transport_notary),
+               theNymID = Identifier::Factory(mynym);
+    ConstNym pNym = Opentxs::Client().Wallet().Nym(theNymID);
+    if (false == bool(pNym)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load mynym.")
+            .Flush();
+        return false;
+    }
+
+    // The ledger is parsed once here, and each instrument is taken from it
+    // by receipt ID, rather than handing the serialized inbox back to
+    // Ledger_GetInstrument (which parses all of it again) for every index.
+    auto pInbox =
+        Opentxs::Client().OTAPI().LoadPaymentInbox(theNotaryID, theNymID);
+    if (false == bool(pInbox)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot load payment inbox.")
+            .Flush();
+        return false;
+    }
+
+    const auto& transactions = pInbox->GetTransactionMap();
+    items.reserve(transactions.size());
+    std::int32_t nIndex = (-1);
+
+    for (const auto& it : transactions) {
+        PaymentItem item;
+        item.index_ = ++nIndex;  // 0 on first iteration.
+        auto pPayment = GetInstrumentByReceiptID(*pNym, it.first, *pInbox);
+
+        if (false != bool(pPayment) && pPayment->SetTempValues()) {
+            auto strPayment = String::Factory();
+
+            if (pPayment->GetPaymentContents(strPayment)) {
+                item.instrument_ = strPayment->Get();
+                item.type_ = pPayment->GetTypeString();
+            }
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    return true;
+}
+
 bool RecordList::accept_from_paymentbox(  // static function
     const std::string& transport_notary,
     const std::string& myacct,
     const std::string& indices,
     const std::string& paymentType,
     std::string* pOptionalOutput /*=nullptr*/)
+{
+    return 0 != accept_from_paymentbox(
+                    transport_notary,
+                    myacct,
+                    indices,
+                    std::vector<std::string>{paymentType},
+                    pOptionalOutput);
+}
+
+std::int32_t RecordList::accept_from_paymentbox(  // static function
+    const std::string& transport_notary,
+    const std::string& myacct,
+    const std::string& indices,
+    const std::vector<std::string>& paymentTypes,
+    std::string* pOptionalOutput /*=nullptr*/)
 {
     if (transport_notary.empty()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
@@ -261,7 +430,8 @@ bool RecordList::accept_from_paymentbox(  // static function
         return -1;
     }
 
-    std::string acct_server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+    std::string acct_server = Stats::Swig(
+        [&]() { return SwigWrap::GetAccountWallet_NotaryID(myacct); });
     if (acct_server.empty()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot determine payment "
                                            "notary from myacct.")
@@ -269,7 +439,8 @@ bool RecordList::accept_from_paymentbox(  // static function
         return -1;
     }
 
-    std::string mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+    std::string mynym = Stats::Swig(
+        [&]() { return SwigWrap::GetAccountWallet_NymID(myacct); });
     if (mynym.empty()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot determine mynym from myacct.")
@@ -277,127 +448,109 @@ bool RecordList::accept_from_paymentbox(  // static function
         return -1;
     }
 
-    std::string inbox = SwigWrap::LoadPaymentInbox(transport_notary, mynym);
-    if (inbox.empty()) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot load payment inbox.")
-            .Flush();
-        return -1;
+    for (const auto& paymentType : paymentTypes) {
+        if ("SMARTCONTRACT" == paymentType) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": accept_from_paymentbox: It's a bug that this function was "
+                "even called at all! "
+                "You CANNOT confirm smart contracts via this function. "
+                "The reason is because you have to select various accounts "
+                "during the "
+                "confirmation process. The function confirmSmartContract "
+                "would ask various questions "
+                "at the command line about which accounts to choose. Thus, "
+                "you MUST have "
+                "your own code in the GUI itself that performs that process "
+                "for smart contracts.")
+                .Flush();
+            return -1;
+        }
     }
 
-    std::int32_t items =
-        SwigWrap::Ledger_GetCount(transport_notary, mynym, mynym, inbox);
-    if (0 > items) {
+    // Only payment plans can be accepted from here, and only when asked for
+    // by name: "ANY" or "all" must never agree to a recurring plan. Every
+    // other type is a deposit, which processPayment can't do, so don't load
+    // and classify the inbox just to fail each item.
+    const bool plans =
+        paymentTypes.end() !=
+        std::find(paymentTypes.begin(), paymentTypes.end(), "PAYMENT PLAN");
+
+    const bool all = ("" == indices || "all" == indices);
+
+    if (false == plans) {
+        if (!checkIndices("indices", indices)) { return -1; }
+
         LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot load payment inbox item count.")
+            ": Error: depositing payment instruments is not supported.")
             .Flush();
-        return -1;
+
+        // Like a pass which failed on every item: "all" still counts as
+        // processed, an explicit selection as failed.
+        return all ? 1 : -1;
     }
 
-    if (!checkIndicesRange("indices", indices, items)) { return -1; }
+    PaymentItems payments;
+
+    if (!load_payment_inbox(transport_notary, mynym, payments)) { return -1; }
+
+    const auto items = static_cast<std::int32_t>(payments.size());
+    std::vector<bool> selected;
+
+    if (!parse_indices("indices", indices, items, selected)) { return -1; }
 
     if (0 == items) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": The payment inbox is empty.")
             .Flush();
         return 0;
     }
-
-    // Regarding bIsDefinitelyPaymentPlan:
-    // I say "definitely" because there are cases where this could be false
-    // and it's still a payment plan. For example, someone may have passed
-    // "ANY" instead of "PAYMENT PLAN" -- in that case, it's still a payment
-    // plan, but at this spot we just don't DEFINITELY know that yet.
-    // Is that a problem? No, because processPayment can actually handle that
-    // case as well. But I still prefer to handle it higher up (here) where
-    // possible, so I can phase out the other. IOW, I actually want to disallow
-    // processPayment from processing payment plans. You shouldn't be able
-    // to agree to a long-term recurring payment plan by just accepting "all".
-    // Rather, you should have to specifically look at that plan, and explicitly
-    // confirm your agreement to it, before it can get activated. That's what
-    // I'm enforcing here.
-    //
-    const bool bIsDefinitelyPaymentPlan = ("PAYMENT PLAN" == paymentType);
-    const bool bIsDefinitelySmartContract = ("SMARTCONTRACT" == paymentType);
-
-    if (bIsDefinitelySmartContract) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": accept_from_paymentbox: It's a bug that this function was even "
-            "called at all! "
-            "You CANNOT confirm smart contracts via this function. "
-            "The reason is because you have to select various accounts "
-            "during the "
-            "confirmation process. The function confirmSmartContract "
-            "would ask various questions "
-            "at the command line about which accounts to choose. Thus, "
-            "you MUST have "
-            "your own code in the GUI itself that performs that process "
-            "for smart contracts.")
-            .Flush();
-        return -1;
-    }
     // ----------
-    bool all = ("" == indices || "all" == indices);
-
     const std::int32_t nNumlistCount =
-        all ? 0 : SwigWrap::NumList_Count(indices);
+        all ? 0
+            : static_cast<std::int32_t>(
+                  std::count(selected.begin(), selected.end(), true));
 
     // NOTE: If we are processing multiple indices, then the return value
     // is 1, since some indices may succeed and some may fail. So our return
     // value merely communicates: The processing was performed.
     //
     // ===> Whereas if there is only ONE index, then we need to set the return
-    // value directly to the result of processing that index. Just watch
-    // nReturnValue
-    // to see how that is being done.
+    // value directly to the result of processing that index. (If it isn't a
+    // payment plan, that's a failure.)
     //
-    std::int32_t nReturnValue = 1;
+    std::int32_t nReturnValue = (1 == nNumlistCount) ? -1 : 1;
 
+    // Expired plans are moved out of the inbox as they are found, so work
+    // downwards to keep the indices of the items still to come valid.
     for (std::int32_t i = items - 1; 0 <= i; i--) {
-        if (all || SwigWrap::NumList_VerifyQuery(indices, std::to_string(i))) {
-            if (bIsDefinitelyPaymentPlan) {
-                std::string instrument =
-                    get_payment_instrument(transport_notary, mynym, i, inbox);
-                if (instrument.empty()) {
-                    LogNormal(OT_METHOD)(__FUNCTION__)(
-                        ": accept_from_paymentbox: "
-                        "Error: cannot get payment instrument from "
-                        "inpayments box.")
-                        .Flush();
-                    return -1;
-                }
+        if (!selected[i]) { continue; }
 
-                std::string recipient =
-                    SwigWrap::Instrmnt_GetRecipientNymID(instrument);
+        const auto& payment = payments[i];
 
-                std::int32_t nTemp = confirm_payment_plan(
-                    transport_notary,
-                    mynym,
-                    myacct,
-                    recipient,
-                    instrument,
-                    i,
-                    pOptionalOutput);
-                if (1 == nNumlistCount) {  // If there's exactly 1 instrument
-                                           // being singled-out
-                    nReturnValue = nTemp;  // for processing, then return its
-                                           // success/fail status.
-                    break;  // Since there's only one, might as well break;
-                }
-            } else {
-                std::int32_t nTemp = processPayment(
-                    transport_notary,
-                    myacct,
-                    paymentType,
-                    inbox,
-                    i,
-                    pOptionalOutput);
-                if (1 == nNumlistCount) {  // If there's exactly 1 instrument
-                                           // being singled-out
-                    nReturnValue = nTemp;  // for processing, then return its
-                                           // success/fail status.
-                    break;  // Since there's only one, might as well break;
-                }
-            }
+        if (payment.instrument_.empty()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: cannot get payment instrument at index ")(i)(
+                " from the payments inbox.")
+                .Flush();
+            continue;
+        }
+
+        if ("PAYMENT PLAN" != payment.type_) { continue; }
+
+        std::string recipient =
+            SwigWrap::Instrmnt_GetRecipientNymID(payment.instrument_);
+        const std::int32_t nTemp = confirm_payment_plan(
+            transport_notary,
+            mynym,
+            myacct,
+            recipient,
+            payment.instrument_,
+            i,
+            pOptionalOutput);
+
+        if (1 == nNumlistCount) {  // If there's exactly 1 instrument
+                                   // being singled-out
+            nReturnValue = nTemp;  // for processing, then return its
+                                   // success/fail status.
         }
     }
 
@@ -428,340 +581,12 @@ std::int32_t RecordList::processPayment(  // a static method
     std::string* pOptionalOutput /*=nullptr*/,
     bool CLI_input_allowed /*=false*/)
 {
-    //    if (myacct.empty()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Failure: myacct not a valid string.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    auto accountNotaryId = Identifier::Factory();
-    //    std::string acct_server = SwigWrap::GetAccountWallet_NotaryID(myacct);
-    //    if (acct_server.empty()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot determine "
-    //                                           "acct_server from myacct.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    accountNotaryId = Identifier::Factory(acct_server);
-    //
-    //    std::string mynym = SwigWrap::GetAccountWallet_NymID(myacct);
-    //    if (mynym.empty()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: cannot determine mynym from myacct.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    std::string instrument = "";
-    //    if (-1 == index) {
-    //        if (CLI_input_allowed) { instrument = inputText("the instrument");
-    //        } if (instrument.empty()) { return -1; }
-    //    } else {
-    //        instrument = RecordList::get_payment_instrument(
-    //            transport_notary, mynym, index, inbox);
-    //        if (instrument.empty()) {
-    //            LogNormal(OT_METHOD)(__FUNCTION__)(
-    //                ": Error: cannot get payment instrument.")
-    //                .Flush();
-    //            return -1;
-    //        }
-    //    }
-    //
-    //    auto thePayment{Opentxs::Client().Factory().Payment(
-    //        String::Factory(instrument.c_str()))};
-    //
-    //    OT_ASSERT(false != bool(thePayment));
-    //
-    //    if (!thePayment->IsValid() || !thePayment->SetTempValues()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: Failed loading
-    //        payment "
-    //                                           "instrument from string.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    // The Notary ID we found on the payment instrument itself.
-    //    //
-    //    auto paymentNotaryId = Identifier::Factory();
-    //    const bool bGotPaymentNotaryId =
-    //    thePayment->GetNotaryID(paymentNotaryId);
-    //
-    //    if (!bGotPaymentNotaryId) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: Failed getting Notary
-    //        ID "
-    //                                           "from payment instrument.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    auto assetTypeId = Identifier::Factory();
-    //    const bool bGotPaymentAssetTypeId =
-    //        thePayment->GetInstrumentDefinitionID(assetTypeId);
-    //
-    //    if (!bGotPaymentAssetTypeId) {
-    //        // Allowed for now.
-    //
-    //        //        otOut << "Error: cannot determine instrument's asset
-    //        type.\n";
-    //        //        return -1;
-    //        ;
-    //    }
-    //    const std::string strPaymentAssetTypeId = assetTypeId->str();
-    //    std::string type = thePayment->GetTypeString();
-    //
-    //    std::string strIndexErrorMsg = "";
-    //    if (-1 != index) {
-    //        strIndexErrorMsg = "at index " + std::to_string(index) + " ";
-    //    }
-    //
-    //    if (!paymentType.empty() &&  // If there is a payment type specified..
-    //        paymentType != "ANY" &&  // ...and if that type isn't "ANY"...
-    //        paymentType != type)     // ...and it's the wrong type:
-    //    {                            // Then skip this one.
-    //        // Except:
-    //        if (("CHEQUE" == paymentType || "VOUCHER" == paymentType) &&
-    //            (thePayment->IsCheque() || thePayment->IsVoucher())) {
-    //            // in this case we allow it to drop through.
-    //        } else {
-    //            LogNormal(OT_METHOD)(__FUNCTION__)(
-    //                ": Error: invalid instrument type.")
-    //                .Flush();
-    //            return -1;
-    //        }
-    //    }
-    //
-    //    const bool bIsPaymentPlan = thePayment->IsPaymentPlan();
-    //    const bool bIsSmartContract = thePayment->IsSmartContract();
-    //
-    //    if (bIsPaymentPlan) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: Cannot process a payment plan here. You HAVE to "
-    //            "explicitly confirm it using confirmInstrument instead of "
-    //            "processPayment.")
-    //            .Flush();
-    //        // NOTE: I could remove this block and it would still work. I'm
-    //        just
-    //        // deliberately disallowing payment plans here, so you are forced
-    //        to
-    //        // explicitly confirm a payment plan. Otherwise here you might
-    //        confirm
-    //        // a dozen plans under "ANY" and it's just too easy for them to
-    //        slip
-    //        // by.
-    //        return -1;
-    //    }
-    //
-    //    if (bIsSmartContract) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: Cannot process a smart contract here. You HAVE to "
-    //            "provide that functionality in your GUI directly, since you "
-    //            "may have to choose various accounts as part of the "
-    //            "activation process, and your user will need to probably do "
-    //            "that in a GUI wizard. It's not so simple as in this function
-    //            " "where you just have 'myacct'.") .Flush();
-    //        return -1;
-    //    }
-    //
-    //    // Note: I USED to check the ASSET TYPE ID here, but then I removed
-    //    it,
-    //    // since details_deposit_cheque() already verifies that (so I don't
-    //    need
-    //    // to do it twice.)
-    //
-    //    // By this point, we know the invoice has the right instrument
-    //    definition
-    //    // for the account we're trying to use (to pay it from.)
-    //    //
-    //    // But we need to make sure the invoice is made out to mynym (or to no
-    //    // one.) Because if it IS endorsed to a Nym, and mynym is NOT that
-    //    nym,
-    //    // then the transaction will fail. So let's check, before we bother
-    //    // sending it...
-    //
-    //    auto senderNymId = Identifier::Factory(),
-    //         recipientNymId = Identifier::Factory();
-    //    std::string sender, recipient;
-    //
-    //    if (thePayment->GetSenderNymID(senderNymId)) sender =
-    //    senderNymId->str(); if (thePayment->GetRecipientNymID(recipientNymId))
-    //        recipient = recipientNymId->str();
-    //
-    //    std::string endorsee = bIsPaymentPlan ? sender : recipient;
-    //
-    //    // Not all instruments have a specified recipient. But if they do,
-    //    let's
-    //    // make sure the Nym matches.
-    //    if (!endorsee.empty() && (endorsee != mynym)) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": The instrument ")(
-    //            strIndexErrorMsg)(" is endorsed to a specific ")(
-    //            bIsPaymentPlan ? "customer" : "recipient")(" (")(endorsee)(
-    //            ") and it doesn't match the account's owner NymId (")(mynym)(
-    //            "). This is a problem, for example, because you can't deposit
-    //            " "a cheque into your own account, if the cheque is made out
-    //            to " "someone else. (Skipping.)Try specifying a different "
-    //            "account, using --myacct ACCT_ID.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    // At this point I know the invoice isn't made out to anyone, or if it
-    //    is,
-    //    // it's properly made out to the owner of the account which I'm trying
-    //    to
-    //    // use to pay the invoice from. So let's pay it!
-    //    // P.S. recipient might be empty, but mynym is guaranteed to be good.
-    //
-    //    std::string accountAssetType =
-    //        SwigWrap::GetAccountWallet_InstrumentDefinitionID(myacct);
-    //
-    //    if (!strPaymentAssetTypeId.empty() &&
-    //        accountAssetType != strPaymentAssetTypeId) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": The instrument at index
-    //        ")(index)(
-    //            " has a different unit type than the selected account. "
-    //            "(Skipping). Try specifying a different account, using "
-    //            "--myacct ACCT_ID.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    // ---------------------------------------------
-    //    if (paymentNotaryId != accountNotaryId) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": The instrument at index
-    //        ")(index)(
-    //            " has a different Notary ID than the selected account. "
-    //            "(Skipping). Try specifying a different account, using "
-    //            "--myacct ACCT_ID.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    // Below this point we know for a fact that the notary ID on the
-    //    payment
-    //    // instrument is the same as the notary ID for the account (myacct).
-    //    // They are interchangeable. So presumably the caller already did the
-    //    // heavy lifting of selecting the correct account.
-    //    // ---------------------------------------------
-    //    //    if (bIsPaymentPlan) {
-    //    //        // Note: this block is currently unreachable/disallowed.
-    //    //        //       (But it would otherwise work.)
-    //    //        //
-    //    //        // NOTE: We couldn't even do this for smart contracts, since
-    //    //        // the "confirmSmartContract" function assumes it's being
-    //    used
-    //    //        // at the command line, and it asks the user to enter
-    //    various
-    //    //        // data (choose your account, etc) at the command line.
-    //    //        // So ONLY with Payment Plans can we do this here! The GUI
-    //    has
-    //    //        // to provide its own custom code for smart contracts.
-    //    However,
-    //    //        // that code will be easy to write: Just copy the code you
-    //    see
-    //    //        // in confirmInstrument, for smart contracts, and change it
-    //    to
-    //    //        // use GUI input/output instead of command line i/o.
-    //    //        //
-    //    //        CmdConfirm cmd;
-    //    //        return cmd.confirmInstrument(
-    //    //            acct_server,
-    //    //            mynym,
-    //    //            myacct,
-    //    //            recipient,
-    //    //            instrument,
-    //    //            index,
-    //    //            pOptionalOutput);
-    //    //        // NOTE: we don't perform any RecordPayment here because
-    //    //        // confirmInstrument already does that.
-    //    //    }
-    //    // ---------------------------------------------
-    //    time64_t now = SwigWrap::GetTime();
-    //    time64_t from{};
-    //    time64_t until{};
-    //
-    //    bool bGotValidFrom{false};
-    //    bGotValidFrom = thePayment->GetValidFrom(from);
-    //    bool bGotValidTo{false};
-    //    bGotValidTo = thePayment->GetValidTo(until);
-    //
-    //    if (!bGotValidFrom) {
-    //        ;  // TODO Maybe log here. But I think this case is allowed.
-    //    }
-    //    if (!bGotValidTo) {
-    //        ;  // TODO Maybe log here. But I think this case is allowed.
-    //    }
-    //    // TODO here: make sure the logic accounts for the fact that the
-    //    boolean
-    //    // could be false. We should behave properly in the event that a valid
-    //    from
-    //    // or valid to date isn't set on this particular instrument, or if it
-    //    has
-    //    // a zero value or whatever.
-    //    //
-    //    if (now < from) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": The instrument at index
-    //        ")(index)(
-    //            " is not yet within its valid date range. (Skipping).")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    if (until > OT_TIME_ZERO && now > until) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": The instrument at index
-    //        ")(index)(
-    //            " is expired. (Moving it to the record box).")
-    //            .Flush();
-    //
-    //        // Since this instrument is expired, remove it from the payments
-    //        inbox,
-    //        // and move to record box.
-    //        if (0 <= index && SwigWrap::RecordPayment(
-    //                              transport_notary, mynym, true, index, true))
-    //                              {
-    //            return 0;
-    //        }
-    //
-    //        return -1;
-    //    }
-    //
-    //    // IMPORTANT: After the below deposits are completed successfully, the
-    //    // wallet will receive a "successful deposit" server reply. When that
-    //    // happens, OT (internally) needs to go and see if the deposited item
-    //    was a
-    //    // payment in the payments inbox. If so, it should REMOVE it from that
-    //    box
-    //    // and move it to the record box.
-    //    //
-    //    // That's why you don't see me messing with the payments inbox even
-    //    when
-    //    // these are successful. They DO need to be removed from the payments
-    //    inbox,
-    //    // but just not here in the script. (Rather, internally by OT itself.)
-    //    if (thePayment->IsCheque() || thePayment->IsVoucher() ||
-    //        thePayment->IsInvoice()) {
-    //        return depositCheque(
-    //            acct_server, myacct, mynym, instrument, pOptionalOutput);
-    //    } else if (thePayment->IsPurse()) {
-    //        std::int32_t success{-1};
-    //#if OT_CASH
-    //        success = Opentxs::Client().Cash().deposit_purse(
-    //            acct_server, myacct, mynym, instrument, "", pOptionalOutput);
-    //#endif  // OT_CASH
-    //        // if index != -1, go ahead and call RecordPayment on the purse at
-    //        that
-    //        // index, to remove it from payments inbox and move it to the
-    //        recordbox. if (index != -1 && 1 == success) {
-    //            SwigWrap::RecordPayment(transport_notary, mynym, true, index,
-    //            true);
-    //        }
-    //
-    //        return success;
-    //    }
-    //
-    //    LogNormal(OT_METHOD)(__FUNCTION__)(
-    //        ": Skipping this instrument: Expected CHEQUE, VOUCHER, INVOICE, "
-    //        "or (cash) PURSE.")
-    //        .Flush();
-    //
+    // Cheques, vouchers, invoices and purses were deposited through the
+    // ServerAction API, which the client no longer has.
+    LogNormal(OT_METHOD)(__FUNCTION__)(
+        ": Error: depositing payment instruments is not supported.")
+        .Flush();
+
     return -1;
 }
 
@@ -1069,28 +894,31 @@ bool RecordList::checkIndices(const char* name, const std::string& indices)
 
     if ("all" == indices) { return true; }
 
-    for (std::string::size_type i = 0; i < indices.length(); i++) {
-        if (!isdigit(indices[i])) {
-            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
-                ": not a value: ")(indices)(".")
-                .Flush();
-            return false;
-        }
-        for (i++; i < indices.length() && isdigit(indices[i]); i++) {}
-        if (i < indices.length() && ',' != indices[i]) {
-            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
-                ": not a value: ")(indices)(".")
-                .Flush();
-            return false;
-        }
+    if (!for_each_index_range(
+            indices, [](std::int64_t, std::int64_t) { return true; })) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
+            ": not a value: ")(indices)(".")
+            .Flush();
+        return false;
     }
 
     return true;
 }
 
+// static
+bool RecordList::reserve_transaction_numbers(
+    const std::string& server,
+    const std::string& mynym,
+    std::size_t quantity)
+{
+    return Opentxs::Numbers().Reserve(server, mynym, quantity);
+}
+
 // static
 bool RecordList::checkServer(const char* name, std::string& server)
 {
+    Stats::Scope scope("resolve");
+
     if (!checkMandatory(name, server)) return false;
 
     auto theID = Identifier::Factory(server);
@@ -1150,6 +978,8 @@ bool RecordList::checkNym(
     std::string& nym,
     bool checkExistance /*=false*/)
 {
+    Stats::Scope scope("resolve");
+
     if (!checkMandatory(name, nym)) return false;
 
     ConstNym pNym = nullptr;
@@ -1179,6 +1009,8 @@ bool RecordList::checkNym(
 // static
 bool RecordList::checkAccount(const char* name, std::string& accountID)
 {
+    Stats::Scope scope("resolve");
+
     if (!checkMandatory(name, accountID)) { return false; }
 
     auto theID = Identifier::Factory(accountID);
@@ -1224,7 +1056,8 @@ std::int32_t RecordList::discard_incoming_payments(
 
     if (!checkIndices("indices", indices)) { return -1; }
 
-    std::string inbox = SwigWrap::LoadPaymentInbox(the_server, the_mynym);
+    const std::string inbox = Stats::Ledger(
+        [&]() { return SwigWrap::LoadPaymentInbox(the_server, the_mynym); });
     if (inbox.empty()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment inbox.")
@@ -1232,8 +1065,10 @@ std::int32_t RecordList::discard_incoming_payments(
         return -1;
     }
 
-    std::int32_t items =
-        SwigWrap::Ledger_GetCount(the_server, the_mynym, the_mynym, inbox);
+    std::int32_t items = Stats::Swig([&]() {
+        return SwigWrap::Ledger_GetCount(
+            the_server, the_mynym, the_mynym, inbox);
+    });
     if (0 > items) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment inbox item count.")
@@ -1247,17 +1082,19 @@ std::int32_t RecordList::discard_incoming_payments(
         return 0;
     }
 
-    bool all = ("all" == indices);
+    std::vector<bool> selected;
+
+    if (!parse_indices("indices", indices, items, selected)) { return -1; }
 
     // Loop from back to front, in case any are removed.
     std::int32_t retVal = 1;
     for (std::int32_t i = items - 1; 0 <= i; i--) {
-        if (!all &&
-            !SwigWrap::NumList_VerifyQuery(indices, std::to_string(i))) {
-            continue;
-        }
+        if (!selected[i]) { continue; }
 
-        if (!SwigWrap::RecordPayment(the_server, the_mynym, true, i, false)) {
+        if (!Stats::Swig([&]() {
+                return SwigWrap::RecordPayment(
+                    the_server, the_mynym, true, i, false);
+            })) {
             LogNormal(OT_METHOD)(__FUNCTION__)(
                 ": Error: cannot discard payment.")
                 .Flush();
@@ -1303,7 +1140,8 @@ std::int32_t RecordList::cancel_outgoing_payments(
 
     if (!checkIndices("indices", indices)) { return -1; }
 
-    std::int32_t items = SwigWrap::GetNym_OutpaymentsCount(the_mynym);
+    std::int32_t items = Stats::Swig(
+        [&]() { return SwigWrap::GetNym_OutpaymentsCount(the_mynym); });
     if (0 > items) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment outbox item count.")
@@ -1317,15 +1155,14 @@ std::int32_t RecordList::cancel_outgoing_payments(
         return 0;
     }
 
-    bool all = ("all" == indices);
+    std::vector<bool> selected;
+
+    if (!parse_indices("indices", indices, items, selected)) { return -1; }
 
     // Loop from back to front, in case any are removed.
     std::int32_t retVal = 1;
     for (std::int32_t i = items - 1; 0 <= i; i--) {
-        if (!all &&
-            !SwigWrap::NumList_VerifyQuery(indices, std::to_string(i))) {
-            continue;
-        }
+        if (!selected[i]) { continue; }
 
         std::string payment =
             SwigWrap::GetNym_OutpaymentsContentsByIndex(the_mynym, i);
@@ -1574,256 +1411,223 @@ std::int32_t RecordList::acceptFromInbox(  // a static method
     const std::string& indices,
     const std::int32_t itemTypeFilter)
 {
-    //    std::string server = SwigWrap::GetAccountWallet_NotaryID(myacct);
-    //    if (server.empty()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: cannot determine server from myacct.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //
-    //    std::string mynym = SwigWrap::GetAccountWallet_NymID(myacct);
-    //    if (mynym.empty()) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: cannot determine mynym from myacct.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    // -----------------------------------------------------------
-    //    // NOTE: I just removed this during my most recent changes. It just
-    //    seems,
-    //    // now with Justus' regular automated refreshes, I shouldn't have to
-    //    grab
-    //    // these right BEFORE, when I then anyway have to grab them right
-    //    AFTER
-    //    // (at the end of this function) once it succeeds. Should speed things
-    //    // up?
-    //    // Also, I considered the fact that we're using indices in this
-    //    function
-    //    // So if the user has actually selected certain indices already, then
-    //    seems
-    //    // unwise to download the inbox before processing THOSE indices.
-    //    Rather
-    //    // have it fail and re-try, and at least be trying the actual intended
-    //    // indices, and cut our account retrievals in half while we're at it!
-    //    //
-    //    //    if (!Opentxs::Client().ME().retrieve_account(server, mynym,
-    //    myacct,
-    //    //    true)) {
-    //    //        otOut << "Error retrieving intermediary files for
-    //    account.\n";
-    //    //        return -1;
-    //    //    }
-    //    // -----------------------------------------------------------
-    //    // NOTE: Normally we don't have to do this, because the high-level API
-    //    is
-    //    // smart enough, when sending server transaction requests, to grab new
-    //    // transaction numbers if it is running low. But in this case, we need
-    //    the
-    //    // numbers available BEFORE sending the transaction request, because
-    //    the
-    //    // call to SwigWrap::Ledger_CreateResponse is where the number is
-    //    first
-    //    // needed, and that call is made before the server transaction request
-    //    is
-    //    // actually sent.
-    //    //
-    //    const auto theNotaryID = Identifier::Factory(server),
-    //               theNymID = Identifier::Factory(mynym),
-    //               theAcctID = Identifier::Factory(myacct);
-    //
-    //    {
-    //        if (!Opentxs::Client().ServerAction().GetTransactionNumbers(
-    //                theNymID, theNotaryID, 10)) {
-    //            LogNormal(OT_METHOD)(__FUNCTION__)(
-    //                ": Error: cannot reserve transaction numbers.")
-    //                .Flush();
-    //            return -1;
-    //        }
-    //    }
-    //    // -----------------------------------------------------------
-    //    auto pInbox(
-    //        Opentxs::Client().OTAPI().LoadInbox(theNotaryID, theNymID,
-    //        theAcctID));
-    //    if (false == bool(pInbox)) {
-    //        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load inbox.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    // -----------------------------------------------------------
-    //    std::int32_t item_count = pInbox->GetTransactionCount();
-    //    // -----------------------------------------------------------
-    //    if (0 > item_count) {
-    //        LogOutput(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: Cannot load inbox item count.").Flush();
-    //        return -1;
-    //    } else if (0 == item_count) {
-    //        LogDetail(OT_METHOD)(__FUNCTION__)(": The inbox is
-    //        empty.").Flush(); return 0;
-    //    }
-    //
-    //    if (!RecordList::checkIndicesRange("indices", indices, item_count)) {
-    //        return -1;
-    //    }
-    //
-    //    bool all = ("" == indices || "all" == indices);
-    //    // -----------------------------------------------------------
-    //    std::set<std::int32_t>* pOnlyForIndices{nullptr};
-    //    std::set<std::int32_t> setForIndices;
-    //    if (!all) {
-    //        NumList numlistForIndices{indices};
-    //        std::set<std::int64_t> setForIndices64;
-    //        if (numlistForIndices.Output(setForIndices64)) {
-    //            pOnlyForIndices = &setForIndices;
-    //            for (const std::int64_t& lIndex : setForIndices64) {
-    //                setForIndices.insert(static_cast<std::int32_t>(lIndex));
-    //            }
-    //        }
-    //    }
-    //    std::set<TransactionNumber> receiptIds{
-    //        pInbox->GetTransactionNums(pOnlyForIndices)};
-    //
-    //    if (receiptIds.size() < 1) {
-    //        LogDetail(OT_METHOD)(__FUNCTION__)(
-    //            ": There are no inbox receipts to process.")
-    //            .Flush();
-    //        return 0;
-    //    }
-    //    // -----------------------------------------------------------
-    //    // NOTE: Indices are only optional. Otherwise it's "accept all
-    //    receipts".
-    //    // But even if you DID pass in a comma-separated list of indices, it
-    //    doesn't
-    //    // matter below this point.
-    //    // That's because we have now translated the user-selected GUI indices
-    //    into
-    //    // an actual set of receipt IDs, each being the trans num on a
-    //    transaction
-    //    // inside the inbox.
-    //
-    //    // -------------------------------------------------------
-    //    OT_API::ProcessInbox response{
-    //        Opentxs::Client().OTAPI().Ledger_CreateResponse(
-    //            theNotaryID, theNymID, theAcctID)};
-    //    // -------------------------------------------------------
-    //    auto& processInbox = std::get<0>(response);
-    //    auto& inbox = std::get<1>(response);
-    //
-    //    if (!bool(processInbox) || !bool(inbox)) {
-    //        LogDetail(OT_METHOD)(__FUNCTION__)(
-    //            ": Ledger_CreateResponse somehow failed.")
-    //            .Flush();
-    //        return -1;
-    //    }
-    //    // -------------------------------------------------------
-    //    for (const TransactionNumber& lReceiptId : receiptIds) {
-    //        OTTransaction* pReceipt =
-    //            Opentxs::Client().OTAPI().Ledger_GetTransactionByID(
-    //                *inbox, lReceiptId);
-    //
-    //        if (nullptr == pReceipt) {
-    //            LogOutput(OT_METHOD)(__FUNCTION__)(
-    //                  ": Unexpectedly got a nullptr for ReceiptId: ")(
-    //                      lReceiptId)(".").Flush();
-    //            return -1;
-    //        }  // Below this point, pReceipt is a good pointer. It's
-    //        //   owned by inbox, so no need to delete.
-    //        // ------------------------
-    //        // itemTypeFilter == 0 for all, 1 for transfers only, 2 for
-    //        receipts
-    //        // only.
-    //        //
-    //        if (0 != itemTypeFilter) {
-    //            const transactionType receipt_type{pReceipt->GetType()};
-    //
-    //            const bool transfer = (transactionType::pending ==
-    //            receipt_type);
-    //
-    //            if ((1 == itemTypeFilter) && !transfer) {
-    //                // not a pending transfer.
-    //                continue;
-    //            }
-    //            if ((2 == itemTypeFilter) && transfer) {
-    //                // not a receipt.
-    //                continue;
-    //            }
-    //        }
-    //        // ------------------------
-    //        const bool bReceiptResponseCreated =
-    //            Opentxs::Client().OTAPI().Transaction_CreateResponse(
-    //                theNotaryID,
-    //                theNymID,
-    //                theAcctID,
-    //                *processInbox,
-    //                *pReceipt,
-    //                true);
-    //
-    //        if (!bReceiptResponseCreated) {
-    //            LogOutput(OT_METHOD)(__FUNCTION__)(
-    //                  ": Error: Cannot create transaction response.").Flush();
-    //            return -1;
-    //        }
-    //    }  // for
-    //    // -------------------------------------------------------
-    //    if (processInbox->GetTransactionCount() <= 0) {
-    //        // did not process anything
-    //        LogOutput(OT_METHOD)(__FUNCTION__)(
-    //              ": Should never happen. Might want to follow up if you see
-    //              this "
-    //                 "log.").Flush();
-    //        return 0;
-    //    }
-    //    // ----------------------------------------------
-    //    const bool bFinalized =
-    //    Opentxs::Client().OTAPI().Ledger_FinalizeResponse(
-    //        theNotaryID, theNymID, theAcctID, *processInbox);
-    //
-    //    if (!bFinalized) {
-    //        LogOutput(OT_METHOD)(__FUNCTION__)(
-    //            ": Error: Cannot finalize response.").Flush();
-    //        return -1;
-    //    }
-    //    // ----------------------------------------------
-    //    std::string notary_response;
-    //    {
-    //        notary_response =
-    //            Opentxs::Client()
-    //                .ServerAction()
-    //                .ProcessInbox(theNymID, theNotaryID, theAcctID,
-    //                processInbox)
-    //                ->Run();
-    //    }
-    //    std::int32_t reply = InterpretTransactionMsgReply(
-    //
-    //        Opentxs::Client(),
-    //        server,
-    //        mynym,
-    //        myacct,
-    //        "process_inbox",
-    //        notary_response);
+    std::string server = Stats::Swig(
+        [&]() { return SwigWrap::GetAccountWallet_NotaryID(myacct); });
+    if (server.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot determine server from myacct.")
+            .Flush();
+        return -1;
+    }
+
+    std::string mynym = Stats::Swig(
+        [&]() { return SwigWrap::GetAccountWallet_NymID(myacct); });
+    if (mynym.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot determine mynym from myacct.")
+            .Flush();
+        return -1;
+    }
+    // -----------------------------------------------------------
+    // NOTE: We don't download the account BEFORE processing it. If the user
+    // has selected certain indices already, it seems unwise to download the
+    // inbox before processing THOSE indices. Rather have it fail and re-try,
+    // and at least be trying the actual intended indices, and cut our account
+    // retrievals in half while we're at it!
+    //
+    const auto theNotaryID = Identifier::Factory(server),
+               theNymID = Identifier::Factory(mynym),
+               theAcctID = Identifier::Factory(myacct);
+
+    auto pInbox(
+        Opentxs::Client().OTAPI().LoadInbox(theNotaryID, theNymID, theAcctID));
+    if (false == bool(pInbox)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load inbox.")
+            .Flush();
+        return -1;
+    }
+    // -----------------------------------------------------------
+    std::int32_t item_count = pInbox->GetTransactionCount();
+    // -----------------------------------------------------------
+    if (0 > item_count) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Error: Cannot load inbox item count.")
+            .Flush();
+        return -1;
+    } else if (0 == item_count) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": The inbox is empty.").Flush();
+        return 0;
+    }
+
+    std::vector<bool> selected;
+
+    if (!parse_indices("indices", indices, item_count, selected)) {
+        return -1;
+    }
+    // -----------------------------------------------------------
+    // Translate the user-selected indices into the receipt IDs (the trans
+    // num on each transaction inside the inbox.) Below this point the
+    // indices don't matter any more, since receipt IDs stay the same while
+    // the inbox shrinks.
     //
-    //    if (1 != reply) { return reply; }
+    // itemTypeFilter == 0 for all, 1 for transfers only, 2 for receipts only.
     //
-    //    // We KNOW they all just changed, since we just processed
-    //    // the inbox. Might as well refresh our copy with the new changes.
-    //    //
-    //    {
-    //        if (!Opentxs::Client().ServerAction().DownloadAccount(
-    //                theNymID, theNotaryID, theAcctID, true)) {
-    //            LogNormal(OT_METHOD)(__FUNCTION__)(
-    //                ": Success processing inbox, but then failed "
-    //                "retrieving intermediary files for account.")
-    //                .Flush();
-    //            //          return -1;
-    //            // By this point we DID successfully process the inbox.
-    //            // (We just then subsequently failed to download the updated
-    //            acct
-    //            // files.)
-    //        }
-    //    }
-    //
-    //    return 1;
-    return -1;
+    std::vector<TransactionNumber> receiptIds;
+    std::int32_t nIndex = (-1);
+
+    for (const auto& it : pInbox->GetTransactionMap()) {
+        ++nIndex;  // 0 on first iteration.
+
+        if (!selected[nIndex]) { continue; }
+
+        const auto& pReceipt = it.second;
+        OT_ASSERT(false != bool(pReceipt));
+
+        if (typeBoth != itemTypeFilter) {
+            const bool transfer =
+                (transactionType::pending == pReceipt->GetType());
+
+            if ((typeTransfers == itemTypeFilter) && !transfer) { continue; }
+            if ((typeReceipts == itemTypeFilter) && transfer) { continue; }
+        }
+
+        receiptIds.push_back(it.first);
+    }
+
+    if (receiptIds.empty()) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(
+            ": There are no inbox receipts to process.")
+            .Flush();
+        return 0;
+    }
+    // -----------------------------------------------------------
+    // Every receipt goes into the same signed processInbox message, under a
+    // single balance agreement, unless there are so many that the message
+    // would get too big. Then they're split into as few messages as possible.
+    //
+    const std::size_t batches =
+        (receiptIds.size() + INBOX_RESPONSES_PER_MESSAGE - 1) /
+        INBOX_RESPONSES_PER_MESSAGE;
+
+    // NOTE: Normally we don't have to do this, because the high-level API is
+    // smart enough, when sending server transaction requests, to grab new
+    // transaction numbers if it is running low. But in this case, we need the
+    // numbers available BEFORE sending the transaction request, because the
+    // call to Ledger_CreateResponse is where the number is first needed, and
+    // that call is made before the server transaction request is actually
+    // sent. One number per message.
+    //
+    if (!reserve_transaction_numbers(server, mynym, batches)) { return -1; }
+
+    for (std::size_t first = 0; first < receiptIds.size();
+         first += INBOX_RESPONSES_PER_MESSAGE) {
+        const auto last = std::min(
+            receiptIds.size(), first + INBOX_RESPONSES_PER_MESSAGE);
+
+        if (1 < batches) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Accepting inbox items ")(
+                first + 1)(" to ")(last)(" of ")(receiptIds.size())(".")
+                .Flush();
+        }
+
+        // -------------------------------------------------------
+        OT_API::ProcessInbox response{
+            Opentxs::Client().OTAPI().Ledger_CreateResponse(
+                theNotaryID, theNymID, theAcctID)};
+        // -------------------------------------------------------
+        auto& processInbox = std::get<0>(response);
+        auto& inbox = std::get<1>(response);
+
+        if (!bool(processInbox) || !bool(inbox)) {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Ledger_CreateResponse somehow failed.")
+                .Flush();
+            return -1;
+        }
+        // -------------------------------------------------------
+        for (auto i = first; i < last; i++) {
+            const TransactionNumber lReceiptId = receiptIds[i];
+            OTTransaction* pReceipt =
+                Opentxs::Client().OTAPI().Ledger_GetTransactionByID(
+                    *inbox, lReceiptId);
+
+            if (nullptr == pReceipt) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Unexpectedly got a nullptr for ReceiptId: ")(
+                    lReceiptId)(".")
+                    .Flush();
+                return -1;
+            }  // Below this point, pReceipt is a good pointer. It's
+            //   owned by inbox, so no need to delete.
+
+            const bool bReceiptResponseCreated =
+                Opentxs::Client().OTAPI().Transaction_CreateResponse(
+                    theNotaryID,
+                    theNymID,
+                    theAcctID,
+                    *processInbox,
+                    *pReceipt,
+                    true);
+
+            if (!bReceiptResponseCreated) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Error: Cannot create transaction response.")
+                    .Flush();
+                return -1;
+            }
+        }  // for
+        // ----------------------------------------------
+        const bool bFinalized =
+            Opentxs::Client().OTAPI().Ledger_FinalizeResponse(
+                theNotaryID, theNymID, theAcctID, *processInbox);
+
+        if (!bFinalized) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Error: Cannot finalize response.")
+                .Flush();
+            return -1;
+        }
+        // ----------------------------------------------
+        std::string notary_response;
+        {
+            notary_response =
+                Opentxs::Client()
+                    .ServerAction()
+                    .ProcessInbox(
+                        theNymID, theNotaryID, theAcctID, processInbox)
+                    ->Run();
+        }
+        std::int32_t reply = InterpretTransactionMsgReply(
+            Opentxs::Client(),
+            server,
+            mynym,
+            myacct,
+            "process_inbox",
+            notary_response);
+
+        if (1 != reply) { return reply; }
+
+        // We KNOW they all just changed, since we just processed the inbox.
+        // The next message's balance agreement has to be made against the
+        // new balance, and after the last one we might as well refresh our
+        // copy with the new changes.
+        //
+        if (!Opentxs::Client().ServerAction().DownloadAccount(
+                theNymID, theNotaryID, theAcctID, true)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Success processing inbox, but then failed "
+                "retrieving intermediary files for account.")
+                .Flush();
+
+            // By this point we DID successfully process these items. (We
+            // just then subsequently failed to download the updated acct
+            // files.) Without them there's no balance to agree to for the
+            // rest.
+            if (last < receiptIds.size()) { return -1; }
+        }
+    }
+
+    return 1;
 }
 
 void RecordList::AddAccountID(std::string str_id)
@@ -2639,6 +2443,7 @@ bool RecordList::PerformAutoAccept()
 
 bool RecordList::Populate()
 {
+    Stats::Scope scope("populate");
     ClearContents();
     // Loop through all the accounts.
     //
@@ -2672,8 +2477,8 @@ bool RecordList::Populate()
 
         // For each Nym, loop through his OUTPAYMENTS box.
         //
-        const std::int32_t nOutpaymentsCount =
-            SwigWrap::GetNym_OutpaymentsCount(str_nym_id);
+        const std::int32_t nOutpaymentsCount = Stats::Swig(
+            [&]() { return SwigWrap::GetNym_OutpaymentsCount(str_nym_id); });
         LogVerbose("--------").Flush();
         LogVerbose(__FUNCTION__)(": Nym ")(nNymIndex)(", nOutpaymentsCount: ")(
             nOutpaymentsCount)(", ID: ")(theNymID)
@@ -3278,6 +3083,8 @@ bool RecordList::Populate()
             std::unique_ptr<Ledger> pInbox{nullptr};
 
             if (false == theNymID->empty()) {
+                Stats::Scope scope("ledger");
+
                 pInbox =
                     m_bRunFast
                         ? Opentxs::Client().OTAPI().LoadPaymentInboxNoVerify(
@@ -3619,6 +3426,8 @@ bool RecordList::Populate()
             std::unique_ptr<Ledger> pRecordbox{nullptr};
 
             if (false == theNymID->empty()) {
+                Stats::Scope scope("ledger");
+
                 pRecordbox =
                     m_bRunFast
                         ? Opentxs::Client().OTAPI().LoadRecordBoxNoVerify(
@@ -4225,6 +4034,8 @@ bool RecordList::Populate()
             std::unique_ptr<Ledger> pExpiredbox{nullptr};
 
             if (false == theNymID->empty()) {
+                Stats::Scope scope("ledger");
+
                 pExpiredbox =
                     m_bRunFast
                         ? Opentxs::Client().OTAPI().LoadExpiredBoxNoVerify(
@@ -4873,6 +4684,8 @@ bool RecordList::Populate()
         std::unique_ptr<Ledger> pInbox{nullptr};
 
         if (false == theNymID.empty()) {
+            Stats::Scope scope("ledger");
+
             pInbox = m_bRunFast ? Opentxs::Client().OTAPI().LoadInboxNoVerify(
                                       theNotaryID, theNymID, theAccountID)
                                 : Opentxs::Client().OTAPI().LoadInbox(
@@ -5116,6 +4929,8 @@ bool RecordList::Populate()
         std::unique_ptr<Ledger> pOutbox{nullptr};
 
         if (false == theNymID.empty()) {
+            Stats::Scope scope("ledger");
+
             pOutbox = m_bRunFast ? Opentxs::Client().OTAPI().LoadOutboxNoVerify(
                                        theNotaryID, theNymID, theAccountID)
                                  : Opentxs::Client().OTAPI().LoadOutbox(
@@ -5294,6 +5109,8 @@ bool RecordList::Populate()
         std::unique_ptr<Ledger> pRecordbox{nullptr};
 
         if (false == theNymID.empty()) {
+            Stats::Scope scope("ledger");
+
             pRecordbox = m_bRunFast
                              ? Opentxs::Client().OTAPI().LoadRecordBoxNoVerify(
                                    theNotaryID, theNymID, theAccountID)
@@ -10,6 +10,7 @@
 
 #include "Record.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
@@ -32,6 +33,15 @@ class RecordList
 public:
     enum ItemType { typeBoth = 0, typeTransfers = 1, typeReceipts = 2 };
 
+    /** A payment inbox entry, with its instrument extracted and classified
+     * once when the inbox is loaded. */
+    struct PaymentItem {
+        std::int32_t index_{-1};
+        std::string instrument_;
+        std::string type_;
+    };
+    typedef std::vector<PaymentItem> PaymentItems;
+
     const api::client::Manager& client_;
 
     EXPORT static bool accept_from_paymentbox(
@@ -40,11 +50,25 @@ public:
         const std::string& indices,
         const std::string& paymentType,
         std::string* pOptionalOutput = nullptr);
+    /** Confirms the selected payment plans in the payment inbox, if
+     * paymentTypes names "PAYMENT PLAN". Deposits of the other types aren't
+     * supported and fail without loading the inbox. */
+    EXPORT static std::int32_t accept_from_paymentbox(
+        const std::string& transport_notary,
+        const std::string& myacct,
+        const std::string& indices,
+        const std::vector<std::string>& paymentTypes,
+        std::string* pOptionalOutput = nullptr);
 
     EXPORT static bool checkIndicesRange(
         const char* name,
         const std::string& indices,
         std::int32_t items);
+    EXPORT static bool parse_indices(
+        const char* name,
+        const std::string& indices,
+        std::int32_t items,
+        std::vector<bool>& selected);
 
     EXPORT static std::string get_payment_instrument(
         const std::string& notaryID,
@@ -52,6 +76,11 @@ public:
         std::int32_t nIndex,
         const std::string& PRELOADED_INBOX);
 
+    EXPORT static bool load_payment_inbox(
+        const std::string& transport_notary,
+        const std::string& mynym,
+        PaymentItems& items);
+
     EXPORT static std::int32_t confirm_payment_plan(
         const std::string& server,
         const std::string& mynym,
@@ -83,10 +112,18 @@ public:
         const std::string& instrument,
         std::string* pOptionalOutput = nullptr);
 
+    /** Accepts the selected inbox items in as few processInbox messages as
+     * possible: normally one, with a single balance agreement. */
     EXPORT static std::int32_t acceptFromInbox(
         const std::string& myacct,
         const std::string& indices,
         const std::int32_t itemTypeFilter);
+    /** Makes sure the nym has at least quantity transaction numbers on the
+     * server, fetching more as needed. */
+    EXPORT static bool reserve_transaction_numbers(
+        const std::string& server,
+        const std::string& mynym,
+        std::size_t quantity);
 
     EXPORT static bool checkMandatory(
         const char* name,
@@ -213,6 +250,7 @@ private:
     list_of_strings m_accounts;
     list_of_strings m_nyms;
     vec_RecordList m_contents;
+    static const std::size_t INBOX_RESPONSES_PER_MESSAGE;
     static const std::string s_blank;
     static const std::string s_message_type;
 };
@@ -0,0 +1,147 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Stats.hpp"
+
+#include "Trace.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+namespace
+{
+struct Timer {
+    std::chrono::nanoseconds elapsed_{0};
+    std::uint64_t count_{0};
+};
+
+// Keyed by the literal's contents, so the same name from different
+// translation units lands in one entry.
+struct Totals {
+    std::mutex lock_;
+    std::map<std::string, Timer> timers_;
+    std::map<std::string, std::uint64_t> counters_;
+};
+
+Totals& totals()
+{
+    static Totals totals;
+
+    return totals;
+}
+
+double to_ms(std::chrono::nanoseconds value)
+{
+    return static_cast<double>(value.count()) / 1e6;
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+Stats::Scope::Scope(const char* name)
+    : name_(name)
+    , start_(std::chrono::steady_clock::now())
+{
+}
+
+Stats::Scope::~Scope()
+{
+    const auto end = std::chrono::steady_clock::now();
+    Stats::Add(name_, end - start_);
+
+    if (Trace::Running()) { Trace::Span(name_, start_, end); }
+}
+
+void Stats::Add(const char* name, std::chrono::nanoseconds elapsed)
+{
+    auto& data = totals();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    auto& timer = data.timers_[name];
+    timer.elapsed_ += elapsed;
+    ++timer.count_;
+}
+
+void Stats::bytes(const std::string& ledger)
+{
+    Count("bytes", ledger.size());
+}
+
+void Stats::Count(const char* name, std::uint64_t value)
+{
+    auto& data = totals();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    data.counters_[name] += value;
+}
+
+void Stats::Reset()
+{
+    auto& data = totals();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    data.timers_.clear();
+    data.counters_.clear();
+}
+
+void Stats::Write(
+    std::ostream& out,
+    const std::string& command,
+    std::chrono::nanoseconds wall,
+    bool json)
+{
+    auto& data = totals();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    if (json) {
+        out << "{\"command\":";
+        Trace::WriteString(out, command);
+        out << ",\"wall_ms\":" << to_ms(wall) << ",\"timers\":{";
+        bool first{true};
+
+        for (const auto& it : data.timers_) {
+            out << (first ? "" : ",");
+            Trace::WriteString(out, it.first);
+            out << ":{\"ms\":" << to_ms(it.second.elapsed_)
+                << ",\"count\":" << it.second.count_ << "}";
+            first = false;
+        }
+
+        out << "},\"counters\":{";
+        first = true;
+
+        for (const auto& it : data.counters_) {
+            out << (first ? "" : ",");
+            Trace::WriteString(out, it.first);
+            out << ":" << it.second;
+            first = false;
+        }
+
+        out << "}}\n";
+    } else {
+        out << "Stats for " << command << ":\n"
+            << "  " << std::left << std::setw(14) << "wall" << std::right
+            << std::setw(12) << to_ms(wall) << " ms\n";
+
+        // Concurrent scopes overlap, so timers can add up to more than wall.
+        for (const auto& it : data.timers_) {
+            out << "  " << std::left << std::setw(14) << it.first << std::right
+                << std::setw(12) << to_ms(it.second.elapsed_) << " ms  ("
+                << it.second.count_ << ")\n";
+        }
+
+        for (const auto& it : data.counters_) {
+            out << "  " << std::left << std::setw(14) << it.first << std::right
+                << std::setw(12) << it.second << "\n";
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+}  // namespace opentxs::cli
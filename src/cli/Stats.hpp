@@ -0,0 +1,106 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_STATS_HPP
+#define OPENTXS_CLI_SRC_CLI_STATS_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace opentxs::cli
+{
+/** Process-wide timers and counters behind --stats.
+ *
+ *  Timers are named phases ("network", "resolve", "ledger", "swig", ...)
+ *  that sum the wall time of every Scope with that name and count how often
+ *  it was entered; counters are plain totals such as "bytes". Recording is
+ *  always on and cheap; runCommand prints and resets the totals after each
+ *  command when --stats is given, so library startup ("start") shows up in
+ *  the first command's report. Safe to use from pipeline workers. */
+class Stats
+{
+public:
+    /** Adds its lifetime to the named timer, and records it as a span while
+     *  a Trace is running. */
+    class Scope
+    {
+    public:
+        EXPORT explicit Scope(const char* name);
+
+        EXPORT ~Scope();
+
+    private:
+        const char* name_;
+        const std::chrono::steady_clock::time_point start_;
+
+        Scope() = delete;
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+    };
+
+    EXPORT static void Add(const char* name, std::chrono::nanoseconds elapsed);
+    EXPORT static void Count(const char* name, std::uint64_t value = 1);
+    /** Runs a box or ledger load under the "ledger" timer, and adds the size
+     *  of serialized (string) results to the "bytes" counter. The loads go
+     *  through SwigWrap, so they are charged to "swig" as well. */
+    template <typename Load>
+    static auto Ledger(const Load& load) -> decltype(load())
+    {
+        Scope swig("swig");
+        Scope scope("ledger");
+        auto output = load();
+        bytes(output);
+
+        return output;
+    }
+    EXPORT static void Reset();
+    /** Runs an OTX call that queues a task, charging it to "submit". */
+    template <typename Call>
+    static auto Submit(const Call& call) -> decltype(call())
+    {
+        Scope scope("submit");
+
+        return call();
+    }
+    /** Runs a SwigWrap lookup, charging it to "swig". */
+    template <typename Call>
+    static auto Swig(const Call& call) -> decltype(call())
+    {
+        Scope scope("swig");
+
+        return call();
+    }
+    /** Blocks on an OTX future, charging the wait to "network". */
+    template <typename Future>
+    static decltype(auto) Wait(Future&& future)
+    {
+        Scope scope("network");
+
+        return std::forward<Future>(future).get();
+    }
+    EXPORT static void Write(
+        std::ostream& out,
+        const std::string& command,
+        std::chrono::nanoseconds wall,
+        bool json);
+
+private:
+    EXPORT static void bytes(const std::string& ledger);
+    template <typename T>
+    static void bytes(const T&)
+    {
+    }
+
+    Stats() = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_STATS_HPP
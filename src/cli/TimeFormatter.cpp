@@ -0,0 +1,89 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "TimeFormatter.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstdio>
+
+namespace
+{
+// std::ctime() always uses the C locale names.
+const char* const days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+const char* const months[] = {"Jan",
+                              "Feb",
+                              "Mar",
+                              "Apr",
+                              "May",
+                              "Jun",
+                              "Jul",
+                              "Aug",
+                              "Sep",
+                              "Oct",
+                              "Nov",
+                              "Dec"};
+
+void append_two_digits(std::string& out, long value)
+{
+    out.push_back(static_cast<char>('0' + (value / 10)));
+    out.push_back(static_cast<char>('0' + (value % 10)));
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+TimeFormatter::TimeFormatter()
+    : hour_start_(0)
+    , hour_end_(0)
+    , prefix_()
+    , suffix_()
+    , output_()
+{
+}
+
+void TimeFormatter::load(std::time_t time)
+{
+    struct tm local {};
+
+#ifdef _WIN32
+    localtime_s(&local, &time);
+#else
+    localtime_r(&time, &local);
+#endif
+
+    char buffer[32]{};
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "%.3s %.3s%3d %.2d:",
+        days[local.tm_wday % 7],
+        months[local.tm_mon % 12],
+        local.tm_mday,
+        local.tm_hour);
+    prefix_ = buffer;
+    std::snprintf(buffer, sizeof(buffer), " %d\n", 1900 + local.tm_year);
+    suffix_ = buffer;
+    hour_start_ = time - (60 * local.tm_min + local.tm_sec);
+    hour_end_ = hour_start_ + 3600;
+}
+
+const std::string& TimeFormatter::operator()(
+    std::chrono::system_clock::time_point in)
+{
+    const auto time = std::chrono::system_clock::to_time_t(in);
+
+    if ((time < hour_start_) || (time >= hour_end_)) { load(time); }
+
+    const long offset = static_cast<long>(time - hour_start_);
+    output_.assign(prefix_);
+    append_two_digits(output_, offset / 60);
+    output_.push_back(':');
+    append_two_digits(output_, offset % 60);
+    output_.append(suffix_);
+
+    return output_;
+}
+}  // namespace opentxs::cli
@@ -0,0 +1,51 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_TIMEFORMATTER_HPP
+#define OPENTXS_CLI_SRC_CLI_TIMEFORMATTER_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <string>
+
+namespace opentxs::cli
+{
+/** Formats timestamps the way std::ctime() does, including the trailing
+ *  newline, for long runs of items such as an activity thread.
+ *
+ *  The local time conversion is the expensive part, so it is done once per
+ *  local hour: every timestamp inside the same hour reuses the cached date
+ *  and hour and only the minutes and seconds are filled in. Not thread
+ *  safe; use one formatter per listing. */
+class TimeFormatter
+{
+public:
+    /** Valid until the next call. */
+    EXPORT const std::string& operator()(
+        std::chrono::system_clock::time_point in);
+
+    EXPORT TimeFormatter();
+
+    EXPORT ~TimeFormatter() = default;
+
+private:
+    std::time_t hour_start_;
+    std::time_t hour_end_;
+    // "Www Mmm dd hh:" and " yyyy\n"
+    std::string prefix_;
+    std::string suffix_;
+    std::string output_;
+
+    void load(std::time_t time);
+
+    TimeFormatter(const TimeFormatter&) = delete;
+    TimeFormatter(TimeFormatter&&) = delete;
+    TimeFormatter& operator=(const TimeFormatter&) = delete;
+    TimeFormatter& operator=(TimeFormatter&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_TIMEFORMATTER_HPP
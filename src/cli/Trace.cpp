@@ -0,0 +1,144 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Trace.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define OT_METHOD "opentxs::cli::Trace::"
+
+namespace
+{
+struct Event {
+    std::string name_;
+    opentxs::cli::Trace::Time start_;
+    opentxs::cli::Trace::Time end_;
+    int track_{0};
+};
+
+struct Recorder {
+    std::atomic<bool> running_{false};
+    std::mutex lock_;
+    opentxs::cli::Trace::Time origin_;
+    std::map<std::thread::id, int> tracks_;
+    std::vector<Event> events_;
+};
+
+Recorder& recorder()
+{
+    static Recorder recorder;
+
+    return recorder;
+}
+
+double to_us(std::chrono::steady_clock::duration value)
+{
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(value)
+                   .count()) /
+           1e3;
+}
+}  // namespace
+
+namespace opentxs::cli
+{
+bool Trace::Running() { return recorder().running_; }
+
+void Trace::Span(const std::string& name, Time start, Time end)
+{
+    auto& data = recorder();
+
+    if (false == data.running_) { return; }
+
+    std::lock_guard<std::mutex> lock(data.lock_);
+    // Tracks are numbered in order of first use, so the thread that started
+    // the trace is always track 1.
+    const auto track = data.tracks_.emplace(
+        std::this_thread::get_id(), static_cast<int>(data.tracks_.size()) + 1);
+    data.events_.push_back(Event{
+        name, std::max(start, data.origin_), end, track.first->second});
+}
+
+void Trace::Start(Time origin)
+{
+    auto& data = recorder();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    data.origin_ = origin;
+    data.tracks_.clear();
+    data.tracks_.emplace(std::this_thread::get_id(), 1);
+    data.events_.clear();
+    data.running_ = true;
+}
+
+bool Trace::Stop(const std::string& file)
+{
+    auto& data = recorder();
+    std::lock_guard<std::mutex> lock(data.lock_);
+    data.running_ = false;
+    std::ofstream out(file, std::ios::out | std::ios::trunc);
+
+    if (false == out.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot write ")(file)
+            .Flush();
+
+        return false;
+    }
+
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+    bool first{true};
+
+    for (const auto& it : data.tracks_) {
+        const auto track = it.second;
+        out << (first ? "" : ",\n")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << track << ",\"args\":{\"name\":\""
+            << (1 == track ? "main" : "worker " + std::to_string(track - 1))
+            << "\"}}";
+        first = false;
+    }
+
+    for (const auto& event : data.events_) {
+        out << (first ? "" : ",\n") << "{\"name\":";
+        WriteString(out, event.name_);
+        out << ",\"cat\":\"opentxs-cli\",\"ph\":\"X\",\"ts\":"
+            << to_us(event.start_ - data.origin_)
+            << ",\"dur\":" << to_us(event.end_ - event.start_)
+            << ",\"pid\":1,\"tid\":" << event.track_ << "}";
+        first = false;
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    data.tracks_.clear();
+    data.events_.clear();
+
+    return out.good();
+}
+
+void Trace::WriteString(std::ostream& out, const std::string& value)
+{
+    out << '"';
+
+    for (const auto c : value) {
+        if ('"' == c || '\\' == c) {
+            out << '\\' << c;
+        } else if (0x20 > static_cast<unsigned char>(c)) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+
+    out << '"';
+}
+}  // namespace opentxs::cli
@@ -0,0 +1,46 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_TRACE_HPP
+#define OPENTXS_CLI_SRC_CLI_TRACE_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <ostream>
+#include <string>
+
+namespace opentxs::cli
+{
+/** Span recorder behind --trace.
+ *
+ *  While a trace is running every Stats::Scope also becomes a span, so the
+ *  same phases that --stats totals up ("options", "resolve", "ledger",
+ *  "submit", "network", "render", ...) can be seen on a timeline. Each
+ *  thread gets its own track, which puts concurrent pipeline jobs side by
+ *  side. Stop() writes the spans as Chrome trace-event JSON, which loads in
+ *  chrome://tracing and Perfetto. */
+class Trace
+{
+public:
+    typedef std::chrono::steady_clock::time_point Time;
+
+    EXPORT static bool Running();
+    EXPORT static void Span(const std::string& name, Time start, Time end);
+    /** Spans starting before origin are clipped to it. */
+    EXPORT static void Start(Time origin);
+    /** Returns false if the file could not be written. */
+    EXPORT static bool Stop(const std::string& file);
+    /** Writes value as a JSON string literal. Control characters become
+     *  spaces. */
+    EXPORT static void WriteString(
+        std::ostream& out,
+        const std::string& value);
+
+private:
+    Trace() = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_TRACE_HPP
@@ -0,0 +1,195 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "TransactionNumberPool.hpp"
+
+#include "Stats.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#define OT_METHOD "opentxs::cli::TransactionNumberPool::"
+
+namespace opentxs::cli
+{
+const std::size_t TransactionNumberPool::DEFAULT_LOW_WATERMARK{10};
+const std::size_t TransactionNumberPool::DEFAULT_HIGH_WATERMARK{50};
+
+TransactionNumberPool::TransactionNumberPool(
+    const api::client::Manager& client)
+    : client_(client)
+    , lock_()
+    , wake_()
+    , pools_()
+    , running_(true)
+    , thread_(&TransactionNumberPool::run, this)
+{
+}
+
+std::size_t TransactionNumberPool::Available(
+    const std::string& server,
+    const std::string& mynym) const
+{
+    return available(Key{server, mynym});
+}
+
+std::size_t TransactionNumberPool::available(const Key& key) const
+{
+    const auto context = client_.Wallet().ServerContext(
+        Identifier::Factory(key.second), Identifier::Factory(key.first));
+
+    if (!context) { return 0; }
+
+    return context->AvailableNumbers();
+}
+
+bool TransactionNumberPool::Reserve(
+    const std::string& server,
+    const std::string& mynym,
+    std::size_t quantity)
+{
+    const auto nymID = Identifier::Factory(mynym);
+    const auto serverID = Identifier::Factory(server);
+    const auto& otx = client_.OTX();
+    std::size_t have{0};
+
+    // Each round trip only yields a limited number of transaction numbers,
+    // so keep asking for as long as the server keeps handing them out.
+    while (!otx.CheckTransactionNumbers(nymID, serverID, quantity)) {
+        Stats::Wait(otx.ContextIdle(nymID, serverID));
+
+        const auto current = available(Key{server, mynym});
+
+        if (current <= have) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: cannot reserve transaction numbers. Have ")(
+                current)(", need ")(quantity)(".")
+                .Flush();
+            return false;
+        }
+
+        have = current;
+    }
+
+    // Keep the pool topped up from now on, but at the usual levels: the batch
+    // size was a one-off and shouldn't become the refill target.
+    Watermarks marks{};
+    Watching(server, mynym, marks);
+    Watch(
+        server,
+        mynym,
+        std::max(marks.low_, DEFAULT_LOW_WATERMARK),
+        std::max(marks.high_, DEFAULT_HIGH_WATERMARK));
+
+    return true;
+}
+
+void TransactionNumberPool::run()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (running_) {
+        std::vector<Key> keys;
+
+        for (const auto& it : pools_) { keys.push_back(it.first); }
+
+        // Don't hold the lock while talking to the wallet, so Watch() and
+        // Reserve() never wait on a top-up.
+        lock.unlock();
+
+        for (const auto& key : keys) { top_up(key); }
+
+        lock.lock();
+        wake_.wait_for(lock, std::chrono::seconds(1), [&]() {
+            return !running_ || changed_;
+        });
+        changed_ = false;
+    }
+}
+
+void TransactionNumberPool::top_up(const Key& key)
+{
+    const auto current = available(key);
+    Watermarks marks{};
+
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto it = pools_.find(key);
+
+        if (pools_.end() == it) { return; }
+
+        auto& pool = it->second;
+
+        if (current < pool.marks_.low_) {
+            pool.filling_ = true;
+        } else if (current >= pool.marks_.high_) {
+            pool.filling_ = false;
+        }
+
+        if (!pool.filling_) { return; }
+
+        marks = pool.marks_;
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Topping up transaction numbers for ")(
+        key.second)(" on ")(key.first)(": have ")(current)(", want ")(
+        marks.high_)(".")
+        .Flush();
+
+    // This only queues a getTransactionNumbers request if one is needed; the
+    // reply is processed by the client library in the background.
+    client_.OTX().CheckTransactionNumbers(
+        Identifier::Factory(key.second),
+        Identifier::Factory(key.first),
+        marks.high_);
+}
+
+void TransactionNumberPool::Watch(
+    const std::string& server,
+    const std::string& mynym,
+    std::size_t low,
+    std::size_t high)
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto& pool = pools_[Key{server, mynym}];
+        pool.marks_.low_ = low;
+        pool.marks_.high_ = std::max(low, high);
+        changed_ = true;
+    }
+
+    wake_.notify_one();
+}
+
+bool TransactionNumberPool::Watching(
+    const std::string& server,
+    const std::string& mynym,
+    Watermarks& output) const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    const auto it = pools_.find(Key{server, mynym});
+
+    if (pools_.end() == it) { return false; }
+
+    output = it->second.marks_;
+
+    return true;
+}
+
+TransactionNumberPool::~TransactionNumberPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        running_ = false;
+    }
+
+    wake_.notify_one();
+
+    if (thread_.joinable()) { thread_.join(); }
+}
+}  // namespace opentxs::cli
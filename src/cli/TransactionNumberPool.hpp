@@ -0,0 +1,97 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_TRANSACTIONNUMBERPOOL_HPP
+#define OPENTXS_CLI_SRC_CLI_TRANSACTIONNUMBERPOOL_HPP
+
+#include <opentxs/opentxs.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace opentxs::cli
+{
+/** Keeps transaction numbers on hand for each (nym, notary) pair in use.
+ *
+ *  Reserve() blocks until a pair has enough numbers for the batch that is
+ *  about to start, and from then on the pair is watched: whenever it drops
+ *  below its low watermark, a background thread asks the notary for more
+ *  until it is back up to the high watermark. Batches therefore don't stop
+ *  partway through to wait for a getTransactionNumbers round trip. */
+class TransactionNumberPool
+{
+public:
+    static const std::size_t DEFAULT_LOW_WATERMARK;
+    static const std::size_t DEFAULT_HIGH_WATERMARK;
+
+    struct Watermarks {
+        std::size_t low_{0};
+        std::size_t high_{0};
+    };
+
+    EXPORT std::size_t Available(
+        const std::string& server,
+        const std::string& mynym) const;
+    /** Blocks until the nym has at least quantity numbers on the server, then
+     *  keeps the pair topped up. Returns false if the server stops handing
+     *  out numbers before that. */
+    EXPORT bool Reserve(
+        const std::string& server,
+        const std::string& mynym,
+        std::size_t quantity);
+    /** Starts (or retunes) background top-ups for the pair. */
+    EXPORT void Watch(
+        const std::string& server,
+        const std::string& mynym,
+        std::size_t low,
+        std::size_t high);
+    /** Returns false if the pair isn't being watched. */
+    EXPORT bool Watching(
+        const std::string& server,
+        const std::string& mynym,
+        Watermarks& output) const;
+
+    EXPORT explicit TransactionNumberPool(
+        const api::client::Manager& client);
+
+    EXPORT ~TransactionNumberPool();
+
+private:
+    // server, nym
+    typedef std::pair<std::string, std::string> Key;
+
+    struct Pool {
+        Watermarks marks_;
+        // Set when the pool drops below low_, cleared once it reaches high_.
+        bool filling_{false};
+    };
+
+    const api::client::Manager& client_;
+    mutable std::mutex lock_;
+    std::condition_variable wake_;
+    std::map<Key, Pool> pools_;
+    bool running_{true};
+    // Set by Watch() so a notification sent while run() is topping up, and
+    // so not waiting yet, still ends the next wait early.
+    bool changed_{false};
+    std::thread thread_;
+
+    std::size_t available(const Key& key) const;
+    void run();
+    void top_up(const Key& key);
+
+    TransactionNumberPool() = delete;
+    TransactionNumberPool(const TransactionNumberPool&) = delete;
+    TransactionNumberPool(TransactionNumberPool&&) = delete;
+    TransactionNumberPool& operator=(const TransactionNumberPool&) = delete;
+    TransactionNumberPool& operator=(TransactionNumberPool&&) = delete;
+};
+}  // namespace opentxs::cli
+#endif  // OPENTXS_CLI_SRC_CLI_TRANSACTIONNUMBERPOOL_HPP
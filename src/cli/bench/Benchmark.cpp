@@ -0,0 +1,310 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <thread>
+
+namespace
+{
+bool flag_value(
+    const std::string& arg,
+    const std::string& flag,
+    std::string& value)
+{
+    const auto prefix = "--" + flag + "=";
+
+    if (0 != arg.compare(0, prefix.size(), prefix)) { return false; }
+
+    value = arg.substr(prefix.size());
+
+    return true;
+}
+}  // namespace
+
+namespace opentxs::cli::bench
+{
+State::State(std::int64_t iterations, std::int64_t range)
+    : max_(iterations)
+    , range_(range)
+    , done_(0)
+    , items_(0)
+    , started_(false)
+    , paused_(false)
+    , error_()
+    , real_start_()
+    , cpu_start_(0)
+    , real_(0)
+    , cpu_(0)
+{
+}
+
+bool State::KeepRunning()
+{
+    if (!error_.empty()) { return false; }
+
+    if (!started_) {
+        started_ = true;
+        start();
+    }
+
+    if (done_ < max_) {
+        ++done_;
+
+        return true;
+    }
+
+    if (!paused_) { stop(); }
+
+    return false;
+}
+
+void State::PauseTiming()
+{
+    if (paused_) { return; }
+
+    stop();
+    paused_ = true;
+}
+
+void State::ResumeTiming()
+{
+    if (!paused_) { return; }
+
+    paused_ = false;
+    start();
+}
+
+void State::SkipWithError(const std::string& error)
+{
+    if (started_ && !paused_) { stop(); }
+
+    paused_ = true;
+    error_ = error;
+}
+
+void State::start()
+{
+    real_start_ = std::chrono::steady_clock::now();
+    cpu_start_ = std::clock();
+}
+
+void State::stop()
+{
+    real_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - real_start_);
+    cpu_ += static_cast<double>(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+}
+
+void Registry::Add(
+    const std::string& name,
+    const Function& function,
+    const std::vector<std::int64_t>& ranges)
+{
+    if (ranges.empty()) {
+        cases_.push_back(Case{name, function, 0});
+
+        return;
+    }
+
+    for (const auto& range : ranges) {
+        cases_.push_back(
+            Case{name + "/" + std::to_string(range), function, range});
+    }
+}
+
+Registry::Result Registry::run_case(const Case& item, double minTime)
+{
+    Result output{};
+    output.name_ = item.name_;
+    std::int64_t iterations{1};
+
+    // Same approach as Google Benchmark: grow the iteration count until one
+    // run takes at least minTime, so fast cases aren't dominated by timer
+    // resolution.
+    while (true) {
+        State state(iterations, item.range_);
+        item.function_(state);
+
+        if (!state.error_.empty()) {
+            output.error_ = state.error_;
+
+            return output;
+        }
+
+        const double seconds = state.real_.count() / 1e9;
+
+        if (seconds >= minTime || iterations >= 1000000000) {
+            output.iterations_ = iterations;
+            output.real_ns_ = state.real_.count() / double(iterations);
+            output.cpu_ns_ = state.cpu_ * 1e9 / double(iterations);
+
+            if (0 < state.items_ && 0 < seconds) {
+                output.items_per_second_ = state.items_ / seconds;
+            }
+
+            return output;
+        }
+
+        const double multiplier =
+            (0 < seconds) ? std::min(10.0, minTime * 1.4 / seconds) : 10.0;
+        iterations = std::max(
+            iterations + 1, static_cast<std::int64_t>(iterations * multiplier));
+    }
+}
+
+int Registry::Run(int argc, char* argv[])
+{
+    std::string filter{".*"};
+    std::string format{"console"};
+    std::string out;
+    double minTime{0.5};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        std::string value;
+
+        if (flag_value(arg, "benchmark_filter", value)) {
+            filter = value;
+        } else if (flag_value(arg, "benchmark_format", value)) {
+            format = value;
+        } else if (flag_value(arg, "benchmark_out", value)) {
+            out = value;
+        } else if (flag_value(arg, "benchmark_min_time", value)) {
+            minTime = std::stod(value);
+        } else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+
+            return 1;
+        }
+    }
+
+    if ("console" != format && "json" != format) {
+        std::cerr << "Unknown format: " << format << "\n";
+
+        return 1;
+    }
+
+    const std::regex match(filter);
+    std::vector<Result> results;
+    bool failed{false};
+
+    for (const auto& item : cases_) {
+        if (!std::regex_search(item.name_, match)) { continue; }
+
+        results.push_back(run_case(item, minTime));
+        failed |= !results.back().error_.empty();
+    }
+
+    if ("json" == format) {
+        write_json(std::cout, argv[0], results);
+    } else {
+        write_console(results);
+    }
+
+    if (!out.empty()) {
+        std::ofstream file(out);
+
+        if (!file) {
+            std::cerr << "Cannot write " << out << "\n";
+
+            return 1;
+        }
+
+        write_json(file, argv[0], results);
+    }
+
+    return failed ? 1 : 0;
+}
+
+void Registry::write_console(const std::vector<Result>& results)
+{
+    std::size_t width{9};
+
+    for (const auto& result : results) {
+        width = std::max(width, result.name_.size());
+    }
+
+    std::printf(
+        "%-*s %15s %15s %12s\n",
+        static_cast<int>(width),
+        "Benchmark",
+        "Time (ns)",
+        "CPU (ns)",
+        "Iterations");
+
+    for (const auto& result : results) {
+        if (!result.error_.empty()) {
+            std::printf(
+                "%-*s ERROR: %s\n",
+                static_cast<int>(width),
+                result.name_.c_str(),
+                result.error_.c_str());
+            continue;
+        }
+
+        std::printf(
+            "%-*s %15.0f %15.0f %12lld",
+            static_cast<int>(width),
+            result.name_.c_str(),
+            result.real_ns_,
+            result.cpu_ns_,
+            static_cast<long long>(result.iterations_));
+
+        if (0 < result.items_per_second_) {
+            std::printf(" %.3g items/s", result.items_per_second_);
+        }
+
+        std::printf("\n");
+    }
+}
+
+void Registry::write_json(
+    std::ostream& out,
+    const std::string& executable,
+    const std::vector<Result>& results)
+{
+    char date[64]{};
+    const auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%FT%T%z", std::localtime(&now));
+    out << "{\n  \"context\": {\n    \"date\": \"" << date
+        << "\",\n    \"executable\": \"" << executable
+        << "\",\n    \"num_cpus\": " << std::thread::hardware_concurrency()
+        << "\n  },\n  \"benchmarks\": [";
+    bool first{true};
+
+    for (const auto& result : results) {
+        out << (first ? "\n" : ",\n") << "    {\n      \"name\": \""
+            << result.name_ << "\",\n";
+
+        if (!result.error_.empty()) {
+            out << "      \"error_occurred\": true,\n"
+                << "      \"error_message\": \"" << result.error_
+                << "\"\n    }";
+        } else {
+            out << "      \"iterations\": " << result.iterations_
+                << ",\n      \"real_time\": " << result.real_ns_
+                << ",\n      \"cpu_time\": " << result.cpu_ns_
+                << ",\n      \"time_unit\": \"ns\"";
+
+            if (0 < result.items_per_second_) {
+                out << ",\n      \"items_per_second\": "
+                    << result.items_per_second_;
+            }
+
+            out << "\n    }";
+        }
+
+        first = false;
+    }
+
+    out << "\n  ]\n}\n";
+}
+}  // namespace opentxs::cli::bench
@@ -0,0 +1,110 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_BENCH_BENCHMARK_HPP
+#define OPENTXS_CLI_SRC_CLI_BENCH_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace opentxs::cli::bench
+{
+/** Per-run state handed to a benchmark case, modelled on Google Benchmark's
+ *  benchmark::State so cases read the same:
+ *
+ *      while (state.KeepRunning()) { ... }
+ *
+ *  The harness picks the iteration count; a case only times its loop. */
+class State
+{
+public:
+    bool KeepRunning();
+    void PauseTiming();
+    void ResumeTiming();
+    /** The size argument the case was registered with, or 0. */
+    std::int64_t range() const { return range_; }
+    std::int64_t iterations() const { return done_; }
+    /** Total items handled over all iterations, for items_per_second. */
+    void SetItemsProcessed(std::int64_t items) { items_ = items; }
+    /** Marks the run as failed; KeepRunning() returns false from then on. */
+    void SkipWithError(const std::string& error);
+
+    State(std::int64_t iterations, std::int64_t range);
+
+private:
+    friend class Registry;
+
+    const std::int64_t max_;
+    const std::int64_t range_;
+    std::int64_t done_{0};
+    std::int64_t items_{0};
+    bool started_{false};
+    bool paused_{false};
+    std::string error_;
+    std::chrono::steady_clock::time_point real_start_;
+    std::clock_t cpu_start_{0};
+    std::chrono::nanoseconds real_{0};
+    double cpu_{0};
+
+    void start();
+    void stop();
+};
+
+/** Holds the registered cases and runs them. Understands the Google
+ *  Benchmark flags that matter for comparing runs:
+ *
+ *      --benchmark_filter=<regex>
+ *      --benchmark_format=<console|json>
+ *      --benchmark_out=<file>          (always JSON)
+ *      --benchmark_min_time=<seconds>
+ *
+ *  and writes JSON in the same layout, so its tools can compare results. */
+class Registry
+{
+public:
+    typedef std::function<void(State&)> Function;
+
+    /** Registers name once per entry in ranges (as name/range), or once
+     *  with range 0 if ranges is empty. */
+    void Add(
+        const std::string& name,
+        const Function& function,
+        const std::vector<std::int64_t>& ranges = {});
+    int Run(int argc, char* argv[]);
+
+private:
+    struct Case {
+        std::string name_;
+        Function function_;
+        std::int64_t range_{0};
+    };
+
+    struct Result {
+        std::string name_;
+        std::int64_t iterations_{0};
+        double real_ns_{0};
+        double cpu_ns_{0};
+        double items_per_second_{0};
+        std::string error_;
+    };
+
+    std::vector<Case> cases_;
+
+    static Result run_case(const Case& item, double minTime);
+    static void write_console(const std::vector<Result>& results);
+    static void write_json(
+        std::ostream& out,
+        const std::string& executable,
+        const std::vector<Result>& results);
+};
+
+void RegisterRecordBenchmarks(Registry& registry);
+void RegisterResolverBenchmarks(Registry& registry);
+}  // namespace opentxs::cli::bench
+#endif  // OPENTXS_CLI_SRC_CLI_BENCH_BENCHMARK_HPP
@@ -0,0 +1,59 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Fixture.hpp"
+
+#include "commands/CmdGenerateWallet.hpp"
+#include "opentxs.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+namespace opentxs::cli::bench
+{
+const Fixture& Fixture::Load(bool reload)
+{
+    static Fixture fixture;
+    static bool loaded{false};
+
+    if (loaded && !reload) { return fixture; }
+
+    fixture = Fixture{};
+
+    for (std::int32_t i = 0; i < SwigWrap::GetServerCount(); ++i) {
+        fixture.servers_.push_back(SwigWrap::GetServer_ID(i));
+    }
+
+    for (std::int32_t i = 0; i < SwigWrap::GetNymCount(); ++i) {
+        fixture.nyms_.push_back(SwigWrap::GetNym_ID(i));
+    }
+
+    for (const auto& it : Opentxs::Client().Storage().AccountList()) {
+        fixture.accounts_.push_back(std::get<0>(it));
+    }
+
+    for (std::int32_t i = 0; i < SwigWrap::GetAssetTypeCount(); ++i) {
+        fixture.units_.push_back(SwigWrap::GetAssetType_ID(i));
+    }
+
+    loaded = true;
+
+    return fixture;
+}
+
+bool GenerateFixture(std::size_t records)
+{
+    const auto tenth = std::to_string(records / 10);
+    CmdGenerateWallet generate;
+    const auto result = generate.run(
+        "", "0", "10", "1", "", tenth, tenth, std::to_string(records), "");
+    Fixture::Load(true);
+
+    return 1 == result;
+}
+}  // namespace opentxs::cli::bench
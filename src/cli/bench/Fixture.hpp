@@ -0,0 +1,36 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLI_SRC_CLI_BENCH_FIXTURE_HPP
+#define OPENTXS_CLI_SRC_CLI_BENCH_FIXTURE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace opentxs::cli::bench
+{
+/** IDs found in the wallet the benchmarks run against.
+ *
+ *  Cases that need wallet data (Populate, the resolvers, anything that needs
+ *  a unit definition) read it from here and skip with an error if the wallet
+ *  doesn't have it. Fill a wallet with --generate_fixture=<records>, or run
+ *  generatewallet from the CLI, once per fixture size, each in its own
+ *  --data_dir. */
+struct Fixture {
+    std::vector<std::string> servers_;
+    std::vector<std::string> nyms_;
+    std::vector<std::string> accounts_;
+    std::vector<std::string> units_;
+
+    /** Scans the wallet. Call again after generating data. */
+    static const Fixture& Load(bool reload = false);
+};
+
+/** Builds a wallet with about records record box entries, plus inbox
+ *  receipts and mail at a tenth of that, on an in-process notary. */
+bool GenerateFixture(std::size_t records);
+}  // namespace opentxs::cli::bench
+#endif  // OPENTXS_CLI_SRC_CLI_BENCH_FIXTURE_HPP
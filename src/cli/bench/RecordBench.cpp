@@ -0,0 +1,274 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Benchmark.hpp"
+
+#include "Fixture.hpp"
+#include "Record.hpp"
+#include "RecordList.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+using opentxs::cli::Record;
+using opentxs::cli::RecordList;
+using opentxs::cli::bench::Fixture;
+using opentxs::cli::bench::State;
+
+// Synthetic record list sizes, for the cases that don't need wallet data.
+const std::vector<std::int64_t> sizes_{100, 1000, 10000};
+
+void add_messages(RecordList& list, std::int64_t count)
+{
+    for (std::int64_t i = 0; i < count; ++i) {
+        // Scatter the dates so SortRecords has real work to do.
+        const auto date = static_cast<time64_t>((i * 7919) % 100003);
+        list.AddSpecialMsg(
+            std::to_string(i),
+            0 == i % 2,
+            0,
+            "Subject " + std::to_string(i) + "\nBody of the message.",
+            "my address",
+            "other address",
+            "bitmessage",
+            "Bitmessage",
+            "",
+            date);
+    }
+}
+
+struct Cheque {
+    std::string server_;
+    std::string nym_;
+    std::string account_;
+    std::string contents_;
+};
+
+// Writing a cheque uses up a transaction number, so it is written the first
+// time a case asks for it and reused for every round after that.
+const Cheque& fixture_cheque()
+{
+    static const Cheque cheque = []() {
+        Cheque output;
+        const auto& fixture = Fixture::Load();
+
+        if (fixture.accounts_.empty()) { return output; }
+
+        output.account_ = fixture.accounts_.front();
+        output.server_ =
+            opentxs::SwigWrap::GetAccountWallet_NotaryID(output.account_);
+        output.nym_ =
+            opentxs::SwigWrap::GetAccountWallet_NymID(output.account_);
+        const auto now = opentxs::SwigWrap::GetTime();
+        output.contents_ = opentxs::SwigWrap::WriteCheque(
+            output.server_,
+            1,
+            now,
+            OTTimeAddTimeInterval(
+                now, OTTimeGetSecondsFromTime(OT_TIME_MONTH_IN_SECONDS)),
+            output.account_,
+            output.nym_,
+            "benchmark",
+            "");
+
+        return output;
+    }();
+
+    return cheque;
+}
+
+void populate(State& state, bool fast)
+{
+    const auto& fixture = Fixture::Load();
+
+    if (fixture.nyms_.empty() || fixture.servers_.empty()) {
+        state.SkipWithError("wallet has no nyms or servers");
+
+        return;
+    }
+
+    RecordList list;
+
+    if (fast) { list.SetFastMode(); }
+
+    for (const auto& server : fixture.servers_) { list.AddNotaryID(server); }
+
+    for (const auto& nym : fixture.nyms_) { list.AddNymID(nym); }
+
+    for (const auto& account : fixture.accounts_) {
+        list.AddAccountID(account);
+    }
+
+    for (const auto& unit : fixture.units_) {
+        list.AddInstrumentDefinitionID(unit);
+    }
+
+    std::int64_t items{0};
+
+    while (state.KeepRunning()) {
+        if (!list.Populate()) {
+            state.SkipWithError("Populate failed");
+
+            return;
+        }
+
+        items += list.size();
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+Record transfer_record(RecordList& list, const std::string& unit)
+{
+    return Record(
+        list,
+        "",
+        "",
+        unit,
+        "",
+        "",
+        "",
+        "From: Alice",
+        "1500000000",
+        "12345",
+        "transfer",
+        true,
+        false,
+        false,
+        false,
+        Record::Transfer);
+}
+}  // namespace
+
+namespace opentxs::cli::bench
+{
+void RegisterRecordBenchmarks(Registry& registry)
+{
+    registry.Add("RecordList/Populate/fast", [](State& state) {
+        populate(state, true);
+    });
+    registry.Add("RecordList/Populate/full", [](State& state) {
+        populate(state, false);
+    });
+    registry.Add(
+        "RecordList/AddSpecialMsg",
+        [](State& state) {
+            RecordList list;
+
+            while (state.KeepRunning()) {
+                state.PauseTiming();
+                list.ClearContents();
+                state.ResumeTiming();
+                add_messages(list, state.range());
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range());
+        },
+        sizes_);
+    registry.Add(
+        "RecordList/SortRecords",
+        [](State& state) {
+            RecordList list;
+
+            while (state.KeepRunning()) {
+                state.PauseTiming();
+                list.ClearContents();
+                add_messages(list, state.range());
+                state.ResumeTiming();
+                list.SortRecords();
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range());
+        },
+        sizes_);
+    registry.Add("Record/SetContents/mail", [](State& state) {
+        RecordList list;
+        Record record(
+            list,
+            "",
+            "",
+            "",
+            "",
+            "",
+            "",
+            "From: Alice",
+            "1500000000",
+            "",
+            "message",
+            false,
+            false,
+            false,
+            false,
+            Record::Mail);
+        const std::string contents(4096, 'x');
+
+        while (state.KeepRunning()) { record.SetContents(contents); }
+    });
+    registry.Add("Record/SetContents/cheque", [](State& state) {
+        const auto& cheque = fixture_cheque();
+
+        if (cheque.account_.empty()) {
+            state.SkipWithError("wallet has no accounts");
+
+            return;
+        }
+
+        if (cheque.contents_.empty()) {
+            state.SkipWithError("cannot write a cheque");
+
+            return;
+        }
+
+        RecordList list;
+        Record record(
+            list,
+            cheque.server_,
+            cheque.server_,
+            "",
+            "",
+            cheque.nym_,
+            cheque.account_,
+            "From: Alice",
+            "1500000000",
+            "1",
+            "cheque",
+            true,
+            false,
+            false,
+            false,
+            Record::Instrument);
+
+        while (state.KeepRunning()) { record.SetContents(cheque.contents_); }
+    });
+    registry.Add("Record/FormatDescription", [](State& state) {
+        RecordList list;
+        auto record = transfer_record(list, "");
+        record.SetMemo("Lunch");
+        std::string output;
+
+        while (state.KeepRunning()) { record.FormatDescription(output); }
+    });
+    registry.Add("Record/FormatAmount", [](State& state) {
+        const auto& fixture = Fixture::Load();
+
+        if (fixture.units_.empty()) {
+            state.SkipWithError("wallet has no unit definitions");
+
+            return;
+        }
+
+        RecordList list;
+        const auto record = transfer_record(list, fixture.units_.front());
+        std::string output;
+
+        while (state.KeepRunning()) { record.FormatAmount(output); }
+    });
+}
+}  // namespace opentxs::cli::bench
@@ -0,0 +1,124 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Benchmark.hpp"
+
+#include "Fixture.hpp"
+#include "RecordList.hpp"
+#include "commands/CmdBase.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+using opentxs::cli::RecordList;
+using opentxs::cli::bench::Fixture;
+using opentxs::cli::bench::State;
+
+// checkPurse only exists on CmdBase.
+class Resolver : public opentxs::CmdBase
+{
+public:
+    using CmdBase::checkPurse;
+
+protected:
+    std::int32_t runWithOptions() override { return 0; }
+};
+
+typedef std::function<bool(std::string&)> Resolve;
+typedef std::function<std::string(const std::string&)> Input;
+
+// Resolves input(id) for the first entry of ids on every iteration.
+void resolve(
+    State& state,
+    const std::vector<std::string>& ids,
+    const char* what,
+    const Input& input,
+    const Resolve& function)
+{
+    if (ids.empty()) {
+        state.SkipWithError(std::string("wallet has no ") + what);
+
+        return;
+    }
+
+    const auto value = input(ids.front());
+
+    while (state.KeepRunning()) {
+        auto copy = value;
+
+        if (!function(copy)) {
+            state.SkipWithError("cannot resolve " + value);
+
+            return;
+        }
+    }
+}
+
+std::string full_id(const std::string& id) { return id; }
+
+std::string partial_id(const std::string& id) { return id.substr(0, 8); }
+}  // namespace
+
+namespace opentxs::cli::bench
+{
+void RegisterResolverBenchmarks(Registry& registry)
+{
+    auto nym = [](std::string& value) {
+        return RecordList::checkNym("nym", value);
+    };
+    auto server = [](std::string& value) {
+        return RecordList::checkServer("server", value);
+    };
+    auto purse = [](std::string& value) {
+        static Resolver resolver;
+
+        return resolver.checkPurse("purse", value);
+    };
+
+    registry.Add("Resolve/checkNym/id", [=](State& state) {
+        resolve(state, Fixture::Load().nyms_, "nyms", full_id, nym);
+    });
+    registry.Add("Resolve/checkNym/partial", [=](State& state) {
+        resolve(state, Fixture::Load().nyms_, "nyms", partial_id, nym);
+    });
+    registry.Add("Resolve/checkServer/id", [=](State& state) {
+        resolve(state, Fixture::Load().servers_, "servers", full_id, server);
+    });
+    registry.Add("Resolve/checkServer/partial", [=](State& state) {
+        resolve(
+            state, Fixture::Load().servers_, "servers", partial_id, server);
+    });
+    registry.Add("Resolve/checkServer/name", [=](State& state) {
+        resolve(
+            state,
+            Fixture::Load().servers_,
+            "servers",
+            [](const std::string& id) { return SwigWrap::GetServer_Name(id); },
+            server);
+    });
+    registry.Add("Resolve/checkPurse/id", [=](State& state) {
+        resolve(state, Fixture::Load().units_, "units", full_id, purse);
+    });
+    registry.Add("Resolve/checkPurse/partial", [=](State& state) {
+        resolve(state, Fixture::Load().units_, "units", partial_id, purse);
+    });
+    registry.Add("Resolve/checkPurse/name", [=](State& state) {
+        resolve(
+            state,
+            Fixture::Load().units_,
+            "units",
+            [](const std::string& id) {
+                return SwigWrap::GetAssetType_Name(id);
+            },
+            purse);
+    });
+}
+}  // namespace opentxs::cli::bench
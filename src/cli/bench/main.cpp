@@ -0,0 +1,123 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <opentxs/opentxs.hpp>
+
+#include "Benchmark.hpp"
+#include "Fixture.hpp"
+#include "opentxs.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+opentxs::Opentxs::PasswordCallback* callback_{nullptr};
+opentxs::OTCaller* password_caller_{nullptr};
+
+namespace
+{
+// The client keeps its data under the user's home directory, so pointing
+// that somewhere else keeps the benchmark away from the real wallet.
+void set_home(const std::string& path)
+{
+#ifdef _WIN32
+    _putenv_s("APPDATA", path.c_str());
+#else
+    setenv("HOME", path.c_str(), 1);
+#endif
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    // --generate_fixture=<records> and --data_dir=<path> are ours;
+    // everything else goes to the benchmark registry.
+    const std::string generate{"--generate_fixture="};
+    const std::string data{"--data_dir="};
+    std::size_t records{0};
+    std::string home;
+    std::vector<char*> args{argv[0]};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+
+        if (0 == arg.compare(0, generate.size(), generate)) {
+            records = std::stoul(arg.substr(generate.size()));
+        } else if (0 == arg.compare(0, data.size(), data)) {
+            home = arg.substr(data.size());
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    // Without --data_dir, run in a fresh directory that is removed again at
+    // exit, so nothing (fixture data, notary instance) outlives the run.
+    const bool temporary = home.empty();
+    std::error_code error;
+
+    if (temporary) {
+        const auto unique = std::chrono::system_clock::now()
+                                .time_since_epoch()
+                                .count();
+        home = (std::filesystem::temp_directory_path(error) /
+                ("opentxs-cli-bench-" + std::to_string(unique)))
+                   .string();
+    }
+
+    if (!error) { std::filesystem::create_directories(home, error); }
+
+    if (error) {
+        std::cerr << "Cannot create the data directory " << home << ": "
+                  << error.message() << "\n";
+
+        return 1;
+    }
+
+    set_home(home);
+
+    callback_ = new opentxs::Opentxs::PasswordCallback;
+
+    OT_ASSERT(nullptr != callback_)
+
+    password_caller_ = new opentxs::OTCaller;
+
+    OT_ASSERT(nullptr != password_caller_)
+
+    password_caller_->setCallback(callback_);
+
+    OT_ASSERT(password_caller_->isCallbackSet())
+
+    opentxs::OT::Start({}, {}, password_caller_);
+
+    int returnValue{0};
+    {
+        // RecordList and the resolvers reach the client through Opentxs.
+        opentxs::Opentxs opentxsCLI(opentxs::OT::App().StartClient({}, 0));
+
+        if (0 < records && !opentxs::cli::bench::GenerateFixture(records)) {
+            std::cerr << "Cannot generate the fixture wallet.\n";
+            returnValue = 1;
+        } else {
+            opentxs::cli::bench::Registry registry;
+            opentxs::cli::bench::RegisterRecordBenchmarks(registry);
+            opentxs::cli::bench::RegisterResolverBenchmarks(registry);
+            returnValue =
+                registry.Run(static_cast<int>(args.size()), args.data());
+        }
+    }
+
+    opentxs::OT::Cleanup();
+    delete password_caller_;
+    delete callback_;
+
+    if (temporary) { std::filesystem::remove_all(home, error); }
+
+    return returnValue;
+}
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 using namespace opentxs;
 using namespace std;
@@ -58,15 +59,13 @@ std::int32_t CmdAcceptAll::run(string server, string myacct)
     bool success = 0 <= acceptFromInbox(myacct, "all", opentxs::cli::RecordList::typeBoth);
 
     // Incoming payments -- cheques, purses, vouchers
-    success &=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, "all", "PURSE");
-    success &=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, "all", "CHEQUE");
-
     // Invoices LAST
     // So the MOST money is in the account before it starts paying out.
-    success &=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, "all", "INVOICE");
+    success &= 0 <= acceptFromPaymentbox(
+                        transport_notary,
+                        myacct,
+                        "all",
+                        vector<string>{"PURSE", "CHEQUE", "INVOICE"});
 
     return success ? 1 : -1;
 }
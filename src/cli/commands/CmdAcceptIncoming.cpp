@@ -44,7 +44,7 @@ std::int32_t CmdAcceptIncoming::run(std::string myacct)
     auto task =
         Opentxs::Client().OTX().ProcessInbox(nymID, serverID, accountID);
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
@@ -23,6 +23,7 @@ CmdAcceptInvoices::CmdAcceptInvoices()
     help = "Pay all invoices in myacct's Nym's payments inbox on Server."
            " (Confused yet? New API fixes this kind of problem).";
     usage = "Omitting --indices is the same as specifying --indices all. "
+            "Indices may include ranges, such as --indices 0-499,600. "
             "And FYI, it uses MyAcct's server if one is not provided.";
 }
 
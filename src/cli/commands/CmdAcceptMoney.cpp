@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 using namespace opentxs;
 using namespace std;
@@ -44,9 +45,10 @@ std::int32_t CmdAcceptMoney::run(string server, string myacct)
     // FIX: these OR's should become AND's so we can detect any failure
     bool success =
         0 <= acceptFromInbox(myacct, "all", opentxs::cli::RecordList::typeTransfers);
-    success |=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, "all", "PURSE");
-    success |=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, "all", "CHEQUE");
+    success |= 0 <= acceptFromPaymentbox(
+                        transport_notary,
+                        myacct,
+                        "all",
+                        vector<string>{"PURSE", "CHEQUE"});
     return success ? 1 : -1;
 }
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 using namespace opentxs;
 using namespace std;
@@ -23,6 +24,7 @@ CmdAcceptPayments::CmdAcceptPayments()
     help = "Accept all incoming payments in myacct's Nym's payments inbox on "
            "Server. Confused yet?";
     usage = "Omitting --indices is the same as specifying --indices all. "
+            "Indices may include ranges, such as --indices 0-499,600. "
             "Server defaults to myacct's NotaryId. (Better commands coming "
             "soon based "
             "on the new API).";
@@ -51,10 +53,13 @@ std::int32_t CmdAcceptPayments::run(
     if ("" != indices && !checkIndices("indices", indices)) { return -1; }
 
     // Note: Do NOT process invoices.
-    // FIX: this OR should become AND so we can detect any failure
-    bool success =
-        0 <= acceptFromPaymentbox(transport_notary, myacct, indices, "PURSE");
-    success |=
-        0 <= acceptFromPaymentbox(transport_notary, myacct, indices, "CHEQUE");
-    return success ? 1 : -1;
+    // Both types come from one load of the payment inbox, so indices refer to
+    // the same listing for each.
+    return 0 <= acceptFromPaymentbox(
+                    transport_notary,
+                    myacct,
+                    indices,
+                    vector<string>{"PURSE", "CHEQUE"})
+               ? 1
+               : -1;
 }
@@ -20,7 +20,8 @@ CmdAcceptTransfers::CmdAcceptTransfers()
     args[1] = "[--indices <indices|all>]";
     category = catAccounts;
     help = "Accept all incoming transfers in myacct's inbox.";
-    usage = "Omitting --indices is the same as specifying --indices all.";
+    usage = "Omitting --indices is the same as specifying --indices all. "
+            "Indices may include ranges, such as --indices 0-499,600.";
 }
 
 CmdAcceptTransfers::~CmdAcceptTransfers() {}
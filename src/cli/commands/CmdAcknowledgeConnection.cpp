@@ -49,18 +49,20 @@ std::int32_t CmdAcknowledgeConnection::run(
     std::string password = inputText("Password");
     std::string key = inputText("Key");
 
-    auto task = Opentxs::Client().OTX().AcknowledgeConnection(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        Identifier::Factory(mypurse),
-        true,
-        url,
-        login,
-        password,
-        key);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().AcknowledgeConnection(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            Identifier::Factory(mypurse),
+            true,
+            url,
+            login,
+            password,
+            key);
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to acknowledge connection")
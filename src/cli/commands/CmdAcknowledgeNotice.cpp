@@ -46,14 +46,16 @@ std::int32_t CmdAcknowledgeNotice::run(
 
     if (!checkNym("hisnym", hisnym)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().AcknowledgeNotice(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        Identifier::Factory(mypurse),
-        true);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().AcknowledgeNotice(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            Identifier::Factory(mypurse),
+            true);
+    });
     
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to acknowledge notice")
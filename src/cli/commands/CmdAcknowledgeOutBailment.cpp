@@ -49,14 +49,16 @@ std::int32_t CmdAcknowledgeOutBailment::run(
     std::string terms = inputText("Withdrawal instructions");
     if (0 == terms.size()) { return -1; }
 
-    auto task = Opentxs::Client().OTX().AcknowledgeOutbailment(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        Identifier::Factory(mypurse),
-        terms);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().AcknowledgeOutbailment(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            Identifier::Factory(mypurse),
+            terms);
+    });
     
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -18,21 +18,34 @@ CmdActivitySummary::CmdActivitySummary()
 {
     command = "activitysummary";
     args[0] = "--mynym <nym>";
+    args[1] = "[--timeout <ms> (default 5000)]";
     category = catOtherUsers;
     help = "Display a summary of activity for a nym.";
 }
 
 std::int32_t CmdActivitySummary::runWithOptions()
 {
-    return run(getOption("mynym"));
+    return run(getOption("mynym"), getOption("timeout"));
 }
 
-std::int32_t CmdActivitySummary::run(std::string mynym)
+std::int32_t CmdActivitySummary::run(
+    std::string mynym,
+    const std::string& timeout)
 {
     if (!checkNym("mynym", mynym)) { return -1; }
 
+    if ("" != timeout && !checkValue("timeout", timeout)) { return -1; }
+
     const OTIdentifier nymID = Identifier::Factory(mynym);
+    // Without any threads in storage the summary stays empty, so there is
+    // nothing to wait for.
+    const bool empty =
+        Opentxs::Client().Activity().Threads(nymID, false).empty();
     auto& activity = Opentxs::Client().UI().ActivitySummary(nymID);
+    awaitModel(
+        activity.WidgetID(),
+        [&]() { return empty || activity.First()->Valid(); },
+        timeout);
     LogNormal(OT_METHOD)(__FUNCTION__)(": Activity: ").Flush();
     dashLine();
     auto line = activity.First();
@@ -20,7 +20,7 @@ class CmdActivitySummary : public CmdBase
 public:
     CmdActivitySummary();
 
-    std::int32_t run(std::string mynym);
+    std::int32_t run(std::string mynym, const std::string& timeout);
 
     ~CmdActivitySummary() = default;
 
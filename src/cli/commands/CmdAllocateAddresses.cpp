@@ -0,0 +1,168 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdAllocateAddresses.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdAllocateAddresses::"
+
+namespace opentxs
+{
+CmdAllocateAddresses::CmdAllocateAddresses()
+{
+    command = "allocateaddresses";
+    args[0] = "--mynym <nym>";
+    args[1] = "--account <account ID>";
+    args[2] = "[--count <addresses>]";
+    args[3] = "[--chain <internal or EXTERNAL>]";
+    args[4] = "[--labels <file>]";
+    args[5] = "[--out <csvfile> (default stdout)]";
+    category = catBlockchain;
+    help = "Derive many bitcoin addresses in a Bip44 account";
+    usage = "Writes one index,address,label line per new address. The\n"
+            "labels file holds one label per line, blank lines included;\n"
+            "without --count, one address is allocated per line.\n"
+            "Addresses beyond the end of the labels file get no label.";
+}
+
+std::int32_t CmdAllocateAddresses::runWithOptions()
+{
+    return run(
+        getOption("mynym"),
+        getOption("account"),
+        getOption("count"),
+        getOption("chain"),
+        getOption("labels"),
+        getOption("out"));
+}
+
+std::int32_t CmdAllocateAddresses::run(
+    std::string mynym,
+    const std::string& account,
+    const std::string& count,
+    const std::string& chain,
+    const std::string& labels,
+    const std::string& out)
+{
+    if (false == checkNym("mynym", mynym)) { return -1; }
+
+    const auto accountID = Identifier::Factory(account);
+
+    if (accountID->empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid account ID.").Flush();
+
+        return -1;
+    }
+
+    if ("" != count && !checkValue("count", count)) { return -1; }
+
+    if ("" != chain && "internal" != chain && "external" != chain) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Chain must be internal or external.")
+            .Flush();
+
+        return -1;
+    }
+
+    if ("" == count && "" == labels) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Specify --count, --labels or both.")
+            .Flush();
+
+        return -1;
+    }
+
+    std::vector<std::string> names;
+
+    if ("" != labels) {
+        // Not loadCsv: label N belongs to address N, so blank lines and
+        // lines starting with '#' are labels too, not ones to skip.
+        std::ifstream file(labels);
+
+        if (!file.good()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Cannot open ")(labels)(".")
+                .Flush();
+
+            return -1;
+        }
+
+        std::string line;
+
+        while (std::getline(file, line)) {
+            if (!line.empty() && '\r' == line.back()) { line.pop_back(); }
+
+            names.push_back(line);
+        }
+    }
+
+    const std::size_t total = "" == count ? names.size() : std::stoul(count);
+    const BIP44Chain change =
+        ("internal" == chain) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
+    std::ofstream file;
+
+    if ("" != out) {
+        file.open(out, std::ios::out | std::ios::trunc);
+
+        if (!file.good()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Cannot write ")(out)(".")
+                .Flush();
+
+            return -1;
+        }
+    }
+
+    std::ostream& output = ("" == out) ? std::cout : file;
+    const auto nymID = Identifier::Factory(mynym);
+    const auto& blockchain = Opentxs::Client().Blockchain();
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t allocated{0};
+    output << "index,address,label\n";
+
+    // Each allocation takes the next unused index on the chain, so they
+    // can't be made in parallel.
+    for (; allocated < total; ++allocated) {
+        const std::string label =
+            (allocated < names.size()) ? names[allocated] : "";
+        const auto address =
+            blockchain.AllocateAddress(nymID, accountID, label, change);
+
+        if (false == bool(address)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to allocate address ")(allocated + 1)(" of ")(
+                total)(".")
+                .Flush();
+
+            break;
+        }
+
+        output << address->index() << "," << address->address() << ","
+               << csvField(address->label()) << "\n";
+    }
+
+    output.flush();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    LogNormal(OT_METHOD)(__FUNCTION__)(": Allocated ")(allocated)(" of ")(
+        total)(" addresses in ")(elapsed.count())(" ms.")
+        .Flush();
+
+    if (!output.good()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Cannot write ")(out)(".")
+            .Flush();
+
+        return -1;
+    }
+
+    return (allocated == total) ? 1 : -1;
+}
+}  // namespace opentxs
@@ -9,11 +9,15 @@
 
 #include <ctype.h>
 #include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -122,141 +126,6 @@ MapOfMaps* convert_offerlist_to_maps(OTDB::OfferListNym& offerList)
     return map_of_maps;
 }
 
-// If you have a buy offer, to buy silver for $30, and to sell silver for $35,
-// what happens tomorrow when the market shifts, and you want to buy for $40
-// and sell for $45 ?
-//
-// Well, now you need to cancel certain sell orders from yesterday! Because why
-// on earth would you want to sell silver for $35 while buying it for $40?
-// (knotwork raised ) That would be buy-high, sell-low.
-//
-// Any rational trader would cancel the old $35 sell order before placing a new
-// $40 buy order!
-//
-// Similarly, if the market went DOWN such that my old offers were $40 buy / $45
-// sell, and my new offers are going to be $30 buy / $35 sell, then I want to
-// cancel certain buy orders for yesterday. After all, why on earth would you
-// want to buy silver for $40 meanwhile putting up a new sell order at $35!
-// You would immediately just turn around, after buying something, and sell it
-// for LESS?
-//
-// Since the user would most likely be forced anyway to do this, for reasons of
-// self-interest, it will probably end up as the default behavior here.
-//
-
-// RETURN VALUE: extra_vals will contain a list of offers that need to be
-// removed AFTER
-
-std::int32_t find_strange_offers(
-    const OTDB::OfferDataNym& offer_data,
-    const std::int32_t,
-    const MapOfMaps&,
-    const SubMap&,
-    the_lambda_struct& extra_vals)  // if 10 offers are
-                                    // printed
-                                    // for the SAME market,
-                                    // nIndex will be 0..9
-{
-    std::string strLocation = "find_strange_offers";
-    /*
-    me: How about this — when you do "opentxs newoffer" I can alter that
-    script to automatically cancel any sell offers for a lower amount
-    than my new buy offer, if they're on the same market at the same scale.
-    and vice versa. Vice versa meaning, cancel any bid offers for a higher
-    amount than my new sell offer.
-
-    knotwork: yeah that would work.
-
-    So when placing a buy offer, check all the other offers I already have at
-    the same scale,
-    same asset and currency ID. (That is, the same "market" as denoted by
-    strMapKey in "opentxs showmyoffers")
-    For each, see if it's a sell offer and if so, if the amount is lower than
-    the amount on
-    the new buy offer, then cancel that sell offer from the market. (Because I
-    don't want to buy-high, sell low.)
-
-    Similarly, if placing a sell offer, then check all the other offers I
-    already have at the
-    same scale, same asset and currency ID, (the same "market" as denoted by
-    strMapKey....) For
-    each, see if it's a buy offer and if so, if the amount is higher than the
-    amount of my new
-    sell offer, then cancel that buy offer from the market. (Because I don't
-    want some old buy offer
-    for $10 laying around for the same stock that I'm SELLING for $8! If I dump
-    100 shares, I'll receive
-    $800--I don't want my software to automatically turn around and BUY those
-    same shares again for $1000!
-    That would be a $200 loss.)
-
-    This is done here. This function gets called once for each offer that's
-    active for this Nym.
-    extra_vals contains the relevant info we're looking for, and offer_data
-    contains the current
-    offer (as we loop through ALL this Nym's offers, this function gets called
-    for each one.)
-    So here we just need to compare once, and add to the list if the comparison
-    matches.
-    */
-    /*
-    attr the_lambda_struct::the_vector        // used for returning a list of
-    something.
-    attr the_lambda_struct::the_asset_acct    // for newoffer, we want to remove
-    existing offers for the same accounts in certain cases.
-    attr the_lambda_struct::the_currency_acct // for newoffer, we want to remove
-    existing offers for the same accounts in certain cases.
-    attr the_lambda_struct::the_scale         // for newoffer as well.
-    attr the_lambda_struct::the_price         // for newoffer as well.
-    attr the_lambda_struct::bSelling          // for newoffer as well.
-    */
-    LogTrace(strLocation)(": About to compare the new potential offer against "
-                          "one of the existing ones...")
-        .Flush();
-
-    if ((extra_vals.the_asset_acct == offer_data.asset_acct_id) &&
-        (extra_vals.the_currency_acct == offer_data.currency_acct_id) &&
-        (extra_vals.the_scale == offer_data.scale)) {
-        LogTrace(strLocation)(": the account IDs and the scale match...")
-            .Flush();
-
-        // By this point we know the current offer_data has the same asset acct,
-        // currency acct, and scale
-        // as the offer we're comparing to all the rest.
-        //
-        // But that's not enough: we also need to compare some prices:
-        //
-        // So when placing a buy offer, check all the other offers I already
-        // have.
-        // For each, see if it's a sell offer and if so, if the amount is lower
-        // than the amount on
-        // the new buy offer, then cancel that sell offer from the market.
-        // (Because I don't want to buy-high, sell low.)
-        //
-        if (!extra_vals.bSelling && offer_data.selling &&
-            (stoll(offer_data.price_per_scale) < stoll(extra_vals.the_price))) {
-            extra_vals.the_vector.push_back(offer_data.transaction_id);
-        }
-        // Similarly, when placing a sell offer, check all the other offers I
-        // already have.
-        // For each, see if it's a buy offer and if so, if the amount is higher
-        // than the amount of my new
-        // sell offer, then cancel that buy offer from the market.
-        //
-        else if (
-            extra_vals.bSelling && !offer_data.selling &&
-            (stoll(offer_data.price_per_scale) > stoll(extra_vals.the_price))) {
-            extra_vals.the_vector.push_back(offer_data.transaction_id);
-        }
-    }
-    // We don't actually do the removing here, since we are still looping
-    // through the maps.
-    // So we just add the IDs to a vector so that the caller can do the removing
-    // once this loop is over.
-
-    return 1;
-}
-
 // low level. map_of_maps and sub_map must be good. (assumed.)
 //
 // extra_vals allows you to pass any extra data you want std::into your
@@ -525,6 +394,47 @@ CmdBase::CmdBase()
 
 CmdBase::~CmdBase() {}
 
+bool CmdBase::addContact(
+    const string& label,
+    const string& nymID,
+    const string& paymentCode) const
+{
+    auto& client = Opentxs::Client();
+    const auto id = Identifier::Factory(nymID);
+
+    if (false == client.Contacts().ContactID(id)->empty()) { return true; }
+
+    const auto contact = client.Contacts().NewContact(
+        label, id, client.Factory().PaymentCode(paymentCode));
+
+    return bool(contact);
+}
+
+bool CmdBase::awaitModel(
+    const Identifier& widget,
+    const cli::ModelWait::Ready& ready,
+    const string& timeout) const
+{
+    cli::Stats::Scope scope("model");
+    cli::ModelWait wait(Opentxs::Client(), widget);
+    const std::chrono::milliseconds limit(
+        "" == timeout ? DEFAULT_MODEL_TIMEOUT : stoull(timeout));
+
+    if (wait.Wait(ready, limit)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Ready in ")(
+            wait.Elapsed().count())(" ms.")
+            .Flush();
+
+        return true;
+    }
+
+    LogNormal(OT_METHOD)(__FUNCTION__)(": Not ready after ")(
+        wait.Elapsed().count())(" ms, output may be incomplete.")
+        .Flush();
+
+    return false;
+}
+
 // CHECK USER (download a public key)
 //
 bool CmdBase::check_nym(
@@ -532,12 +442,14 @@ bool CmdBase::check_nym(
     const std::string& nymID,
     const std::string& targetNymID) const
 {
-    auto task = Opentxs::Client().OTX().DownloadNym(
-        Identifier::Factory(nymID),
-        Identifier::Factory(notaryID),
-        Identifier::Factory(targetNymID));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().DownloadNym(
+            Identifier::Factory(nymID),
+            Identifier::Factory(notaryID),
+            Identifier::Factory(targetNymID));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     const auto success = CmdBase::GetResultSuccess(result);
     return success;
@@ -622,6 +534,8 @@ bool CmdBase::checkNym(const char* name, string& nym, bool checkExistance) const
 
 bool CmdBase::checkPurse(const char* name, string& purse) const
 {
+    cli::Stats::Scope scope("resolve");
+
     if (!checkMandatory(name, purse)) return false;
 
     OTIdentifier theID = Identifier::Factory(purse);
@@ -720,9 +634,117 @@ bool CmdBase::checkValue(const char* name, const string& value) const
         }
     }
 
+    if (18 < value.length()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
+            ": value too large: ")(value)(".")
+            .Flush();
+        return false;
+    }
+
     return true;
 }
 
+int32_t CmdBase::convertFile(
+    const string& in,
+    const string& out,
+    bool pack,
+    const cli::ChunkedFile::Convert& convert,
+    const string& expect) const
+{
+    if (!checkMandatory("in", in) || !checkMandatory("out", out)) {
+        return -1;
+    }
+
+    ifstream input(in, ios::in | ios::binary);
+
+    if (!input.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: in: cannot open file: ")(
+            in)(".")
+            .Flush();
+        return -1;
+    }
+
+    ofstream output(out, ios::out | ios::trunc | ios::binary);
+
+    if (!output.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: out: cannot open file: ")(out)(".")
+            .Flush();
+        return -1;
+    }
+
+    const auto start = chrono::steady_clock::now();
+    cli::ChunkedFile file(
+        convert, std::max<std::size_t>(thread::hardware_concurrency(), 1));
+    const bool success =
+        pack ? file.Pack(input, output) : file.Unpack(input, output);
+    output.close();
+    const auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - start);
+
+    if (!success || output.fail()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot convert ")(in)(
+            ".")
+            .Flush();
+        return -1;
+    }
+
+    LogNormal(OT_METHOD)(__FUNCTION__)(": Read ")(file.BytesIn())(
+        " bytes, wrote ")(file.BytesOut())(" bytes to ")(out)(" in ")(
+        elapsed.count())(" ms.")
+        .Flush();
+
+    if ("" == expect) { return 1; }
+
+    ifstream actual(out, ios::in | ios::binary);
+    ifstream expected(expect, ios::in | ios::binary);
+
+    if (!expected.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: expect: cannot open file: ")(expect)(".")
+            .Flush();
+        return -1;
+    }
+
+    // Compare a block at a time, the files can be of any size.
+    const size_t block = cli::ChunkedFile::CHUNK_SIZE;
+    string left(block, '\0');
+    string right(block, '\0');
+    bool same = actual.good();
+
+    while (same && actual.good() && expected.good()) {
+        actual.read(&left[0], block);
+        expected.read(&right[0], block);
+        const auto bytes = static_cast<size_t>(actual.gcount());
+        same = (bytes == static_cast<size_t>(expected.gcount())) &&
+               (0 == left.compare(0, bytes, right, 0, bytes));
+    }
+
+    if (!same || actual.bad() || expected.bad()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(out)(
+            " doesn't match ")(expect)(".")
+            .Flush();
+        return -1;
+    }
+
+    return 1;
+}
+
+string CmdBase::csvField(const string& value) const
+{
+    if (string::npos == value.find_first_of(",\"\r\n")) { return value; }
+
+    string output{"\""};
+
+    for (const auto c : value) {
+        if ('"' == c) { output += '"'; }
+
+        output += c;
+    }
+
+    return output + "\"";
+}
+
 void CmdBase::dashLine() const
 {
     // 76 dashes :-)
@@ -855,6 +877,101 @@ string CmdBase::inputText(const char* what)
     return input;
 }
 
+bool CmdBase::loadCsv(
+    const char* name,
+    const string& path,
+    std::size_t columns,
+    CsvRows& rows) const
+{
+    if (!checkMandatory(name, path)) { return false; }
+
+    ifstream file(path);
+
+    if (!file.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
+            ": cannot open file: ")(path)(".")
+            .Flush();
+        return false;
+    }
+
+    auto trim = [](const string& in) -> string {
+        const auto first = in.find_first_not_of(" \t\r");
+
+        if (string::npos == first) { return ""; }
+
+        return in.substr(first, in.find_last_not_of(" \t\r") - first + 1);
+    };
+
+    string line;
+    std::size_t number{0};
+
+    while (getline(file, line)) {
+        ++number;
+        line = trim(line);
+
+        if (line.empty() || '#' == line[0]) { continue; }
+
+        vector<string> fields;
+        string::size_type begin{0};
+
+        while (fields.size() + 1 < columns) {
+            const auto comma = line.find(',', begin);
+
+            if (string::npos == comma) { break; }
+
+            fields.push_back(trim(line.substr(begin, comma - begin)));
+            begin = comma + 1;
+        }
+
+        fields.push_back(trim(line.substr(begin)));
+        rows.emplace(number, std::move(fields));
+    }
+
+    return true;
+}
+
+std::size_t CmdBase::killMarketOffers(
+    const string& server,
+    const string& mynym,
+    const cli::OfferIndex::Offers& offers,
+    std::size_t depth,
+    const cli::Pipeline::Progress& progress) const
+{
+    if (offers.empty()) { return 0; }
+
+    if (!reserveTransactionNumbers(server, mynym, offers.size())) {
+        return offers.size();
+    }
+
+    cli::Pipeline pipeline(depth);
+
+    for (const auto* offer : offers) {
+        OT_ASSERT(nullptr != offer);
+
+        const auto acct = offer->asset_acct_id;
+        const auto number = offer->number;
+        pipeline.Add([this, server, mynym, acct, number]() -> bool {
+            LogDetail(OT_METHOD)("killMarketOffers")(
+                ": Canceling market offer with transaction number: ")(number)
+                .Flush();
+            const std::string response =
+                Opentxs::Client()
+                    .ServerAction()
+                    .KillMarketOffer(
+                        Identifier::Factory(mynym),
+                        Identifier::Factory(server),
+                        Identifier::Factory(acct),
+                        number)
+                    ->Run();
+
+            return 1 == verifyTxResponse(
+                            server, mynym, acct, response, "kill market offer");
+        });
+    }
+
+    return pipeline.Run(progress);
+}
+
 int32_t CmdBase::processResponse(const string& response, const char* what) const
 {
     switch (responseStatus(response)) {
@@ -883,27 +1000,7 @@ int32_t CmdBase::processTxResponse(
     const string& response,
     const char* what) const
 {
-    if (1 != responseStatus(response)) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot ")(what)(".")
-            .Flush();
-        return -1;
-    }
-
-    if (1 != VerifyMsgBalanceAgrmntSuccess(
-                 Opentxs::Client(), server, mynym, myacct, response)) {
-
-        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(what)(
-            " balance agreement failed.")
-            .Flush();
-        return -1;
-    }
-
-    if (1 != VerifyMsgTrnxSuccess(
-                 Opentxs::Client(), server, mynym, myacct, response)) {
-
-        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(what)(
-            " transaction failed.")
-            .Flush();
+    if (1 != verifyTxResponse(server, mynym, myacct, response, what)) {
         return -1;
     }
 
@@ -912,6 +1009,15 @@ int32_t CmdBase::processTxResponse(
     return 1;
 }
 
+bool CmdBase::reserveTransactionNumbers(
+    const string& server,
+    const string& mynym,
+    std::size_t quantity) const
+{
+    return opentxs::cli::RecordList::reserve_transaction_numbers(
+        server, mynym, quantity);
+}
+
 int32_t CmdBase::responseReply(
     const string& response,
     const string& server,
@@ -991,6 +1097,38 @@ std::string CmdBase::stat_asset_account(const std::string& ACCOUNT_ID) const
            strServerName + " )";
 }
 
+bool CmdBase::startNotary(const string& instance, string& server) const
+{
+    if (!checkValue("instance", instance)) { return false; }
+
+    auto& notary = OT::App().StartServer({}, stoi(instance), true);
+    const auto contract = notary.Wallet().Server(notary.ID());
+
+    if (!contract) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: missing contract for server instance ")(instance)(".")
+            .Flush();
+        return false;
+    }
+
+    // The client keeps a wallet of its own, so it has to be given the
+    // notary's contract before it can send it anything.
+    if (!Opentxs::Client().Wallet().Server(contract->PublicContract())) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot import contract for server instance ")(
+            instance)(".")
+            .Flush();
+        return false;
+    }
+
+    server = notary.ID().str();
+    LogOutput(OT_METHOD)(__FUNCTION__)(": Started server ")(
+        notary.Instance())(" (")(server)(").")
+        .Flush();
+
+    return true;
+}
+
 vector<string> CmdBase::tokenize(const string& str, char delim, bool noEmpty)
     const
 {
@@ -1010,3 +1148,37 @@ vector<string> CmdBase::tokenize(const string& str, char delim, bool noEmpty)
 
     return tokens;
 }
+
+int32_t CmdBase::verifyTxResponse(
+    const string& server,
+    const string& mynym,
+    const string& myacct,
+    const string& response,
+    const char* what) const
+{
+    if (1 != responseStatus(response)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot ")(what)(".")
+            .Flush();
+        return -1;
+    }
+
+    if (1 != VerifyMsgBalanceAgrmntSuccess(
+                 Opentxs::Client(), server, mynym, myacct, response)) {
+
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(what)(
+            " balance agreement failed.")
+            .Flush();
+        return -1;
+    }
+
+    if (1 != VerifyMsgTrnxSuccess(
+                 Opentxs::Client(), server, mynym, myacct, response)) {
+
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(what)(
+            " transaction failed.")
+            .Flush();
+        return -1;
+    }
+
+    return 1;
+}
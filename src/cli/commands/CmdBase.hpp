@@ -9,7 +9,12 @@
 #include <opentxs/opentxs.hpp>
 
 #include "opentxs.hpp"
+#include "ChunkedFile.hpp"
+#include "ModelWait.hpp"
+#include "OfferIndex.hpp"
+#include "Pipeline.hpp"
 #include "RecordList.hpp"
+#include "Stats.hpp"
 
 #include <vector>
 #include <map>
@@ -47,14 +52,6 @@ typedef std::int32_t (*LambdaFunc)(
     the_lambda_struct& extra_vals);
 
 MapOfMaps* convert_offerlist_to_maps(opentxs::OTDB::OfferListNym& offerList);
-std::int32_t find_strange_offers(
-    const opentxs::OTDB::OfferDataNym& offer_data,
-    std::int32_t nIndex,
-    const MapOfMaps& map_of_maps,
-    const SubMap& sub_map,
-    the_lambda_struct& extra_vals);  // if 10 offers are printed
-                                     // for the SAME market,
-                                     // nIndex will be 0..9
 std::int32_t iterate_nymoffers_maps(
     MapOfMaps& map_of_maps,
     LambdaFunc the_lambda);  // low level. map_of_maps
@@ -91,6 +88,10 @@ namespace opentxs
 class OTWallet;
 
 const int MAX_ARGS = 10;
+// Default number of concurrent server requests for bulk commands.
+const std::size_t DEFAULT_IN_FLIGHT = 8;
+// Default number of milliseconds to wait for a UI model to load.
+const std::uint64_t DEFAULT_MODEL_TIMEOUT = 5000;
 
 typedef enum {
     catError = 0,
@@ -110,6 +111,10 @@ typedef enum {
 class CmdBase
 {
 public:
+    // Fields of one line of a comma separated input file, keyed by line
+    // number.
+    typedef std::map<std::size_t, std::vector<std::string>> CsvRows;
+
 	static bool GetResultSuccess(const api::client::OTX::Result& result);
 	
     EXPORT CmdBase();
@@ -129,6 +134,20 @@ protected:
     const char* help;
     const char* usage;
 
+    // Adds nymID to the address book under label unless it is already
+    // there. The contact manager serializes updates, so there is nothing to
+    // gain from calling this from several threads at once.
+    bool addContact(
+        const std::string& label,
+        const std::string& nymID,
+        const std::string& paymentCode) const;
+    // Blocks until a UI model has loaded (see cli::ModelWait) and reports how
+    // long that took. Returns false if it was still incomplete after timeout
+    // milliseconds; whatever has loaded so far can still be shown.
+    bool awaitModel(
+        const Identifier& widget,
+        const cli::ModelWait::Ready& ready,
+        const std::string& timeout) const;
     bool check_nym(
         const std::string& NOTARY_ID,
         const std::string& NYM_ID,
@@ -159,7 +178,21 @@ protected:
     bool checkPurse(const char* name, std::string& purse) const;
     bool checkServer(const char* name, std::string& server) const;
     int64_t checkTransNum(const char* name, const std::string& id) const;
+    // Accepts up to 18 digits, so the value fits any 64 bit integer and
+    // stoul/stoll can't throw on it.
     bool checkValue(const char* name, const std::string& index) const;
+    // Converts the file in into the file out a chunk at a time (see
+    // cli::ChunkedFile), packing if pack is true and unpacking otherwise.
+    // If expect names a file, fails unless out ends up identical to it.
+    int32_t convertFile(
+        const std::string& in,
+        const std::string& out,
+        bool pack,
+        const cli::ChunkedFile::Convert& convert,
+        const std::string& expect = "") const;
+    // Quotes a field of a comma separated output line if it contains a
+    // separator, a quote or a line break.
+    std::string csvField(const std::string& value) const;
     void dashLine() const;
     std::string formatAmount(const std::string& assetType, int64_t amount)
         const;
@@ -171,6 +204,23 @@ protected:
         const std::string& mynym);
     std::string inputLine();
     std::string inputText(const char* what);
+    // Reads a comma separated file, skipping blank lines and lines starting
+    // with '#'. Each row is split into at most columns fields; the last field
+    // keeps any remaining commas, so it can hold free text.
+    bool loadCsv(
+        const char* name,
+        const std::string& path,
+        std::size_t columns,
+        CsvRows& rows) const;
+    // Cancels the offers with at most depth KillMarketOffer requests in
+    // flight. Returns the number of offers that could not be cancelled.
+    std::size_t killMarketOffers(
+        const std::string& server,
+        const std::string& mynym,
+        const cli::OfferIndex::Offers& offers,
+        std::size_t depth,
+        const cli::Pipeline::Progress& progress =
+            cli::Pipeline::Progress()) const;
     int32_t processResponse(const std::string& response, const char* what)
         const;
     int32_t processTxResponse(
@@ -179,6 +229,13 @@ protected:
         const std::string& myacct,
         const std::string& response,
         const char* what) const;
+    // Makes sure the nym holds at least quantity transaction numbers for the
+    // server before a batch starts, so no request in the batch has to stop
+    // and fetch more.
+    bool reserveTransactionNumbers(
+        const std::string& server,
+        const std::string& mynym,
+        std::size_t quantity) const;
     int32_t responseReply(
         const std::string& response,
         const std::string& server,
@@ -187,10 +244,20 @@ protected:
         const char* function) const;
     int32_t responseStatus(const std::string& response) const;
     virtual int32_t runWithOptions() = 0;
+    // Starts (or reuses) an in-process notary and makes sure the client
+    // wallet knows its contract, so benchmarks can run without a network.
+    bool startNotary(const std::string& instance, std::string& server) const;
     std::vector<std::string> tokenize(
         const std::string& str,
         char delim,
         bool noEmpty) const;
+    // Same checks as processTxResponse, without echoing the response.
+    int32_t verifyTxResponse(
+        const std::string& server,
+        const std::string& mynym,
+        const std::string& myacct,
+        const std::string& response,
+        const char* what) const;
 
 private:
     std::vector<std::string> argNames;
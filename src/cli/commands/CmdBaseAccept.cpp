@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <ostream>
 #include <string>
+#include <vector>
 
 using namespace opentxs;
 using namespace std;
@@ -92,3 +93,14 @@ int32_t CmdBaseAccept::acceptFromPaymentbox(
     return opentxs::cli::RecordList::accept_from_paymentbox(
         transport_notary, myacct, indices, paymentType, pOptionalOutput);
 }
+
+int32_t CmdBaseAccept::acceptFromPaymentbox(
+    const string& transport_notary,
+    const string& myacct,
+    const string& indices,
+    const vector<string>& paymentTypes,
+    string* pOptionalOutput /*=nullptr*/) const
+{
+    return opentxs::cli::RecordList::accept_from_paymentbox(
+        transport_notary, myacct, indices, paymentTypes, pOptionalOutput);
+}
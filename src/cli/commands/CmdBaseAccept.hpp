@@ -8,6 +8,9 @@
 
 #include "CmdBase.hpp"
 
+#include <string>
+#include <vector>
+
 namespace opentxs
 {
 
@@ -27,6 +30,13 @@ public:
         const std::string& indices,
         const std::string& paymentType,
         std::string* pOptionalOutput = nullptr) const;
+    // Accepts each type in turn from a single load of the payment inbox.
+    EXPORT int32_t acceptFromPaymentbox(
+        const std::string& transport_notary,
+        const std::string& myacct,
+        const std::string& indices,
+        const std::vector<std::string>& paymentTypes,
+        std::string* pOptionalOutput = nullptr) const;
 };
 
 }  // namespace opentxs
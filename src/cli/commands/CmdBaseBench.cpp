@@ -0,0 +1,363 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdBaseBench.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdBaseBench::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdBaseBench::Phase::Phase(const char* name)
+    : name_(name)
+    , stats_()
+    , elapsed_(0)
+{
+}
+
+CmdBaseBench::CmdBaseBench() {}
+
+CmdBaseBench::~CmdBaseBench() {}
+
+bool CmdBaseBench::addContacts(
+    const vector<string>& nyms,
+    cli::LatencyStats& stats) const
+{
+    bool output{true};
+
+    for (const auto& nym : nyms) {
+        output &= stats.Measure(
+            [&]() { return addContact(SwigWrap::GetNym_Name(nym), nym, nym); });
+    }
+
+    return output;
+}
+
+bool CmdBaseBench::createNyms(
+    const string& label,
+    size_t count,
+    size_t depth,
+    vector<string>& nyms,
+    cli::LatencyStats& stats) const
+{
+    return createNyms(label, {""}, -1, count, depth, nyms, stats);
+}
+
+bool CmdBaseBench::createNyms(
+    const string& label,
+    const vector<string>& seeds,
+    int32_t index,
+    size_t count,
+    size_t depth,
+    vector<string>& nyms,
+    cli::LatencyStats& stats) const
+{
+    nyms.assign(count, "");
+    // Without an explicit index each call reads and then bumps the seed's
+    // next index, so concurrent calls can derive the same nym twice. The
+    // lock is taken before the measurement starts, so waiting for it doesn't
+    // count as latency.
+    mutex nextIndex;
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < count; ++i) {
+        pipeline.Add([&, i]() {
+            const auto& seed = seeds[i % seeds.size()];
+            const auto name = label + " " + to_string(i);
+
+            if (0 > index) {
+                lock_guard<mutex> lock(nextIndex);
+
+                return stats.Measure([&]() {
+                    nyms[i] = SwigWrap::CreateIndividualNym(name, seed, -1);
+
+                    return "" != nyms[i];
+                });
+            }
+
+            const auto path = index + static_cast<int32_t>(i / seeds.size());
+
+            return stats.Measure([&]() {
+                nyms[i] = SwigWrap::CreateIndividualNym(name, seed, path);
+
+                return "" != nyms[i];
+            });
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+string CmdBaseBench::findAccount(
+    const string& server,
+    const string& mynym,
+    const string& unit) const
+{
+    for (const auto& it : Opentxs::Client().Storage().AccountList()) {
+        const auto& myacct = get<0>(it);
+
+        if (server == SwigWrap::GetAccountWallet_NotaryID(myacct) &&
+            mynym == SwigWrap::GetAccountWallet_NymID(myacct) &&
+            unit == SwigWrap::GetAccountWallet_InstrumentDefinitionID(myacct)) {
+            return myacct;
+        }
+    }
+
+    return "";
+}
+
+string CmdBaseBench::issueUnit(
+    const string& server,
+    const string& issuer,
+    const string& label,
+    string& account,
+    cli::LatencyStats& stats) const
+{
+    string unit;
+    const bool issued = stats.Measure([&]() {
+        unit = SwigWrap::CreateCurrencyContract(
+            issuer,
+            label,
+            "Synthetic unit for benchmarking.",
+            label,
+            "B",
+            "BEN",
+            2,
+            "cents");
+
+        if ("" == unit) { return false; }
+
+        auto task = cli::Stats::Submit([&]() {
+            return Opentxs::Client().OTX().IssueUnitDefinition(
+                Identifier::Factory(issuer),
+                Identifier::Factory(server),
+                Identifier::Factory(unit));
+        });
+
+        return CmdBase::GetResultSuccess(cli::Stats::Wait(get<1>(task)));
+    });
+
+    if (!issued) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot issue unit.")
+            .Flush();
+        return "";
+    }
+
+    account = findAccount(server, issuer, unit);
+
+    if ("" == account) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot find the issuer account.")
+            .Flush();
+        return "";
+    }
+
+    return unit;
+}
+
+bool CmdBaseBench::openAccounts(
+    const string& server,
+    const vector<string>& nyms,
+    const string& unit,
+    size_t depth,
+    vector<string>& accounts,
+    cli::LatencyStats& stats) const
+{
+    accounts.assign(nyms.size(), "");
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < nyms.size(); ++i) {
+        pipeline.Add([&, i]() {
+            return stats.Measure([&]() {
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().RegisterAccount(
+                        Identifier::Factory(nyms[i]),
+                        Identifier::Factory(server),
+                        Identifier::Factory(unit));
+                });
+
+                return CmdBase::GetResultSuccess(
+                    cli::Stats::Wait(get<1>(task)));
+            });
+        });
+    }
+
+    bool output = 0 == pipeline.Run();
+
+    // One pass over the wallet for all the new accounts, rather than one
+    // per account, which would be quadratic in the wallet size.
+    map<string, string> owned;
+
+    for (const auto& it : Opentxs::Client().Storage().AccountList()) {
+        const auto& myacct = get<0>(it);
+
+        if (server == SwigWrap::GetAccountWallet_NotaryID(myacct) &&
+            unit == SwigWrap::GetAccountWallet_InstrumentDefinitionID(myacct)) {
+            owned.emplace(SwigWrap::GetAccountWallet_NymID(myacct), myacct);
+        }
+    }
+
+    for (size_t i = 0; i < nyms.size(); ++i) {
+        if (false == pipeline.Succeeded(i)) { continue; }
+
+        const auto found = owned.find(nyms[i]);
+
+        if (owned.end() == found) {
+            output = false;
+        } else {
+            accounts[i] = found->second;
+        }
+    }
+
+    return output;
+}
+
+bool CmdBaseBench::phase(
+    Phases& phases,
+    const char* name,
+    const PhaseJob& job) const
+{
+    phases.emplace_back(name);
+    auto& phase = phases.back();
+    const auto start = chrono::steady_clock::now();
+    const bool success = job(phase.stats_);
+    phase.elapsed_ = chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - start);
+
+    if (!success) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(name)(
+            " did not complete.")
+            .Flush();
+    }
+
+    return success;
+}
+
+bool CmdBaseBench::processInboxes(
+    const string& server,
+    const vector<string>& nyms,
+    const vector<string>& accounts,
+    size_t depth,
+    cli::LatencyStats& stats) const
+{
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < accounts.size(); ++i) {
+        pipeline.Add([&, i]() {
+            return stats.Measure([&]() {
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().ProcessInbox(
+                        Identifier::Factory(nyms[i]),
+                        Identifier::Factory(server),
+                        Identifier::Factory(accounts[i]));
+                });
+
+                return CmdBase::GetResultSuccess(
+                    cli::Stats::Wait(get<1>(task)));
+            });
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+bool CmdBaseBench::registerNyms(
+    const string& server,
+    const vector<string>& nyms,
+    size_t depth,
+    cli::LatencyStats& stats) const
+{
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < nyms.size(); ++i) {
+        pipeline.Add([&, i]() {
+            return stats.Measure([&]() {
+                if (SwigWrap::IsNym_RegisteredAtServer(nyms[i], server)) {
+                    return true;
+                }
+
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().RegisterNymPublic(
+                        Identifier::Factory(nyms[i]),
+                        Identifier::Factory(server),
+                        false,
+                        false);
+                });
+
+                return CmdBase::GetResultSuccess(
+                    cli::Stats::Wait(get<1>(task)));
+            });
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+bool CmdBaseBench::sendTransfers(
+    const string& server,
+    const string& mynym,
+    const string& myacct,
+    const vector<string>& to,
+    size_t count,
+    size_t depth,
+    cli::LatencyStats& stats) const
+{
+    if (to.empty()) { return 0 == count; }
+
+    const auto nymID = Identifier::Factory(mynym);
+    const auto serverID = Identifier::Factory(server);
+    const auto accountID = Identifier::Factory(myacct);
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < count; ++i) {
+        pipeline.Add([&, i]() {
+            return stats.Measure([&]() {
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().SendTransfer(
+                        nymID,
+                        serverID,
+                        accountID,
+                        Identifier::Factory(to[i % to.size()]),
+                        1,
+                        "bench");
+                });
+
+                return CmdBase::GetResultSuccess(
+                    cli::Stats::Wait(get<1>(task)));
+            });
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+void CmdBaseBench::writePhases(ostream& out, const Phases& phases, bool json)
+    const
+{
+    if (json) { out << "["; }
+
+    bool first{true};
+
+    for (const auto& phase : phases) {
+        if (json && !first) { out << ","; }
+
+        phase.stats_.Write(out, phase.name_, phase.elapsed_, json);
+        first = false;
+
+        if (!json) { out << "\n"; }
+    }
+
+    if (json) { out << "]"; }
+}
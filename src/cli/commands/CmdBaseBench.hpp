@@ -0,0 +1,119 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDBASEBENCH_HPP
+#define OPENTXS_CLIENT_CMDBASEBENCH_HPP
+
+#include "CmdBaseInstrument.hpp"
+
+#include "LatencyStats.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+// Building blocks for commands which set up a synthetic economy on a notary
+// (normally an in-process one) and then drive load through it. Each step
+// runs with at most depth requests in flight and records every request in
+// stats.
+class CmdBaseBench : public CmdBaseInstrument
+{
+protected:
+    struct Phase {
+        const std::string name_;
+        cli::LatencyStats stats_;
+        std::chrono::milliseconds elapsed_{0};
+
+        explicit Phase(const char* name);
+    };
+
+    // std::list, because LatencyStats can't be moved.
+    typedef std::list<Phase> Phases;
+    typedef std::function<bool(cli::LatencyStats&)> PhaseJob;
+
+    CmdBaseBench();
+    virtual ~CmdBaseBench() = 0;
+
+    // Adds every nym in nyms to the address book, so they can be paid.
+    bool addContacts(
+        const std::vector<std::string>& nyms,
+        cli::LatencyStats& stats) const;
+    bool createNyms(
+        const std::string& label,
+        std::size_t count,
+        std::size_t depth,
+        std::vector<std::string>& nyms,
+        cli::LatencyStats& stats) const;
+    // Nym i is derived from seeds[i % seeds.size()], at HD index
+    // index + i / seeds.size(), or at the seed's next free index if index
+    // is negative; those nyms are created one at a time. An empty seed is
+    // the wallet's default seed.
+    bool createNyms(
+        const std::string& label,
+        const std::vector<std::string>& seeds,
+        std::int32_t index,
+        std::size_t count,
+        std::size_t depth,
+        std::vector<std::string>& nyms,
+        cli::LatencyStats& stats) const;
+    // Returns the account mynym holds for unit on server, or "".
+    std::string findAccount(
+        const std::string& server,
+        const std::string& mynym,
+        const std::string& unit) const;
+    // Creates a unit definition for issuer and issues it on server. The
+    // issuer account is returned in account.
+    std::string issueUnit(
+        const std::string& server,
+        const std::string& issuer,
+        const std::string& label,
+        std::string& account,
+        cli::LatencyStats& stats) const;
+    // Runs job as a new phase, timing it as a whole.
+    bool phase(Phases& phases, const char* name, const PhaseJob& job) const;
+    bool openAccounts(
+        const std::string& server,
+        const std::vector<std::string>& nyms,
+        const std::string& unit,
+        std::size_t depth,
+        std::vector<std::string>& accounts,
+        cli::LatencyStats& stats) const;
+    // Accepts everything in the inbox of accounts[i], owned by nyms[i].
+    bool processInboxes(
+        const std::string& server,
+        const std::vector<std::string>& nyms,
+        const std::vector<std::string>& accounts,
+        std::size_t depth,
+        cli::LatencyStats& stats) const;
+    bool registerNyms(
+        const std::string& server,
+        const std::vector<std::string>& nyms,
+        std::size_t depth,
+        cli::LatencyStats& stats) const;
+    // Sends count transfers of one unit each from myacct, round robin over
+    // the accounts in to.
+    bool sendTransfers(
+        const std::string& server,
+        const std::string& mynym,
+        const std::string& myacct,
+        const std::vector<std::string>& to,
+        std::size_t count,
+        std::size_t depth,
+        cli::LatencyStats& stats) const;
+    // One line per phase, or a JSON array with one object per phase.
+    void writePhases(std::ostream& out, const Phases& phases, bool json)
+        const;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDBASEBENCH_HPP
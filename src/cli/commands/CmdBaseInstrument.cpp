@@ -8,8 +8,14 @@
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
-#include <ostream>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #define OT_METHOD "opentxs::CmdBaseInstrument::"
@@ -21,6 +27,208 @@ CmdBaseInstrument::CmdBaseInstrument() {}
 
 CmdBaseInstrument::~CmdBaseInstrument() {}
 
+int32_t CmdBaseInstrument::payContact(
+    const string& cheque,
+    const string& sender,
+    const string& recipient) const
+{
+    auto payment{
+        Opentxs::Client().Factory().Payment(String::Factory(cheque.c_str()))};
+
+    OT_ASSERT(false != bool(payment));
+
+    const auto contactid =
+        Opentxs::Client().Contacts().ContactID(Identifier::Factory(recipient));
+
+    std::shared_ptr<const OTPayment> ppayment{payment.release()};
+
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PayContact(
+            Identifier::Factory(sender), contactid, ppayment);
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
+
+    const auto success = CmdBase::GetResultSuccess(result);
+    if (false == success) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to send payment.").Flush();
+
+        return -1;
+    }
+
+    return 1;
+}
+
+int32_t CmdBaseInstrument::sendBatch(
+    string myacct,
+    const string& file,
+    string results,
+    const string& validfor,
+    const string& inflight,
+    bool isInvoice) const
+{
+    if (!checkAccount("myacct", myacct)) { return -1; }
+
+    if ("" != validfor && !checkValue("validfor", validfor)) { return -1; }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    const string server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+    if ("" == server) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot determine server from myacct.")
+            .Flush();
+        return -1;
+    }
+
+    const string mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+    if ("" == mynym) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot determine mynym from myacct.")
+            .Flush();
+        return -1;
+    }
+
+    CsvRows rows;
+
+    if (!loadCsv("file", file, 3, rows)) { return -1; }
+
+    if (rows.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The file is empty.").Flush();
+        return 0;
+    }
+
+    // Everything needed to sign and send each instrument is resolved here
+    // once, so nothing has to be parsed back out of the signed cheque.
+    struct Item {
+        std::size_t line_{0};
+        string hisnym_;
+        string amount_;
+        int64_t value_{0};
+        string memo_;
+        string cheque_;
+    };
+
+    vector<Item> items;
+    std::size_t invalid{0};
+
+    for (const auto& row : rows) {
+        const auto& fields = row.second;
+        Item item;
+        item.line_ = row.first;
+
+        if (2 > fields.size()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": expected hisnym,amount[,memo].")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        item.hisnym_ = fields[0];
+        item.amount_ = fields[1];
+
+        if (2 < fields.size()) { item.memo_ = fields[2]; }
+
+        if (!checkNym("hisnym", item.hisnym_)) {
+            ++invalid;
+            continue;
+        }
+
+        item.value_ = checkAmount("amount", item.amount_, myacct);
+
+        if (OT_ERROR_AMOUNT == item.value_) {
+            ++invalid;
+            continue;
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    if (0 < invalid) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(invalid)(
+            " invalid lines. Nothing was sent.")
+            .Flush();
+        return -1;
+    }
+
+    if (!reserveTransactionNumbers(server, mynym, items.size())) { return -1; }
+
+    const int64_t timeSpan =
+        "" != validfor ? stoll(validfor)
+                       : OTTimeGetSecondsFromTime(OT_TIME_MONTH_IN_SECONDS);
+    const auto start = std::chrono::steady_clock::now();
+
+    // Signing is CPU bound, so it gets one worker per core.
+    cli::Pipeline signer(std::max(std::thread::hardware_concurrency(), 1u));
+
+    for (auto& item : items) {
+        signer.Add([&, it = &item]() -> bool {
+            it->cheque_ = write_cheque(
+                server,
+                mynym,
+                myacct,
+                it->hisnym_,
+                it->value_,
+                it->memo_,
+                timeSpan,
+                isInvoice);
+
+            return "" != it->cheque_;
+        });
+    }
+
+    const auto unsignedCount = signer.Run();
+    const auto signedAt = std::chrono::steady_clock::now();
+
+    const std::size_t depth =
+        "" == inflight ? DEFAULT_IN_FLIGHT : std::stoul(inflight);
+    cli::Pipeline sender(depth);
+
+    for (const auto& item : items) {
+        sender.Add([&, it = &item]() -> bool {
+            if ("" == it->cheque_) { return false; }
+
+            return 1 == payContact(it->cheque_, mynym, it->hisnym_);
+        });
+    }
+
+    const auto failed = sender.Run();
+    const auto finished = std::chrono::steady_clock::now();
+
+    if ("" == results) { results = file + ".results"; }
+
+    ofstream output(results, ios::out | ios::trunc);
+    output << "line,hisnym,amount,status\n";
+
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        const auto& item = items[i];
+        output << item.line_ << "," << csvField(item.hisnym_) << ","
+               << csvField(item.amount_) << ","
+               << ("" == item.cheque_
+                       ? "unsigned"
+                       : (sender.Succeeded(i) ? "ok" : "failed"))
+               << "\n";
+    }
+
+    if (!output.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot write ")(results)
+            .Flush();
+    }
+
+    const auto ms = [](std::chrono::steady_clock::duration in) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(in)
+            .count();
+    };
+    cout << "Signed " << items.size() - unsignedCount << " of " << items.size()
+         << (isInvoice ? " invoices" : " cheques") << " in "
+         << ms(signedAt - start) << " ms, sent " << items.size() - failed
+         << " in " << ms(finished - signedAt)
+         << " ms. Results written to " << results << ".\n";
+
+    return 0 == failed ? 1 : -1;
+}
+
 int32_t CmdBaseInstrument::sendPayment(
     const string& cheque,
     string sender,
@@ -49,29 +257,7 @@ int32_t CmdBaseInstrument::sendPayment(
         return -1;
     }
 
-    auto payment{
-        Opentxs::Client().Factory().Payment(String::Factory(cheque.c_str()))};
-
-    OT_ASSERT(false != bool(payment));
-
-    const auto contactid =
-        Opentxs::Client().Contacts().ContactID(Identifier::Factory(recipient));
-
-    std::shared_ptr<const OTPayment> ppayment{payment.release()};
-
-    auto task = Opentxs::Client().OTX().PayContact(
-        Identifier::Factory(sender), contactid, ppayment);
-
-    const auto result = std::get<1>(task).get();
-    
-    const auto success = CmdBase::GetResultSuccess(result);
-    if (false == success) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to send payment.").Flush();
-
-        return -1;
-    }
-
-    return 1;
+    return payContact(cheque, sender, recipient);
 }
 
 string CmdBaseInstrument::writeCheque(
@@ -109,6 +295,21 @@ string CmdBaseInstrument::writeCheque(
 
     int64_t oneMonth = OTTimeGetSecondsFromTime(OT_TIME_MONTH_IN_SECONDS);
     int64_t timeSpan = "" != validfor ? stoll(validfor) : oneMonth;
+
+    return write_cheque(
+        server, mynym, myacct, hisnym, value, memo, timeSpan, isInvoice);
+}
+
+string CmdBaseInstrument::write_cheque(
+    const string& server,
+    const string& mynym,
+    const string& myacct,
+    const string& hisnym,
+    int64_t value,
+    const string& memo,
+    int64_t timeSpan,
+    bool isInvoice) const
+{
     time64_t from = SwigWrap::GetTime();
     time64_t until = OTTimeAddTimeInterval(from, timeSpan);
 
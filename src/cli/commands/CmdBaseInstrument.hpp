@@ -16,6 +16,20 @@ protected:
     CmdBaseInstrument();
     virtual ~CmdBaseInstrument() = 0;
 
+    int32_t payContact(
+        const std::string& cheque,
+        const std::string& sender,
+        const std::string& recipient) const;
+    // Writes and sends one cheque or invoice per line of file
+    // (hisnym,amount[,memo]), signing on all cores and keeping up to
+    // inflight payments outstanding.
+    int32_t sendBatch(
+        std::string myacct,
+        const std::string& file,
+        std::string results,
+        const std::string& validfor,
+        const std::string& inflight,
+        bool isInvoice) const;
     int32_t sendPayment(
         const std::string& cheque,
         std::string sender,
@@ -27,6 +41,15 @@ protected:
         std::string memo,
         std::string validfor,
         bool isInvoice) const;
+    std::string write_cheque(
+        const std::string& server,
+        const std::string& mynym,
+        const std::string& myacct,
+        const std::string& hisnym,
+        int64_t value,
+        const std::string& memo,
+        int64_t timeSpan,
+        bool isInvoice) const;
 };
 
 }  // namespace opentxs
@@ -0,0 +1,222 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdBench.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdBench::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdBench::CmdBench()
+{
+    command = "bench";
+    args[0] = "[--server <server>]";
+    args[1] = "[--instance <server instance>]";
+    args[2] = "[--nyms <count> (default 4)]";
+    args[3] = "[--ops <operations per type> (default 100)]";
+    args[4] = "[--inflight <requests> (default 8)]";
+    args[5] = "[--json <true|FALSE>]";
+    category = catMisc;
+    help = "Run a scripted end-to-end workload and report throughput.";
+    usage = "Creates and registers --nyms new nyms, issues a unit with the\n"
+            "first one and opens an account for each of the others. The\n"
+            "issuer then sends --ops transfers and --ops cheques round\n"
+            "robin to the other nyms, who accept them. Reports operations\n"
+            "per second and latency percentiles for every step. Use\n"
+            "--instance to start an in-process notary, so the numbers\n"
+            "don't depend on the network.";
+}
+
+CmdBench::~CmdBench() {}
+
+int32_t CmdBench::runWithOptions()
+{
+    return run(
+        getOption("server"),
+        getOption("instance"),
+        getOption("nyms"),
+        getOption("ops"),
+        getOption("inflight"),
+        getOption("json"));
+}
+
+int32_t CmdBench::run(
+    string server,
+    string instance,
+    string nyms,
+    string ops,
+    string inflight,
+    string json)
+{
+    if ("" != instance) {
+        if ("" != server) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: specify either --server or --instance.")
+                .Flush();
+            return -1;
+        }
+    } else if (!checkServer("server", server)) {
+        return -1;
+    }
+
+    if ("" != nyms && !checkValue("nyms", nyms)) { return -1; }
+
+    if ("" != ops && !checkValue("ops", ops)) { return -1; }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    if ("" != json && !checkBoolean("json", json)) { return -1; }
+
+    const size_t nymCount = "" == nyms ? 4 : stoul(nyms);
+    const size_t count = "" == ops ? 100 : stoul(ops);
+    const size_t depth = "" == inflight ? DEFAULT_IN_FLIGHT : stoul(inflight);
+    const size_t cores = max<size_t>(thread::hardware_concurrency(), 1);
+
+    if (2 > nymCount) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: need at least 2 nyms, an issuer and a recipient.")
+            .Flush();
+        return -1;
+    }
+
+    if ("" != instance && !startNotary(instance, server)) { return -1; }
+
+    Phases phases;
+    auto step = [&](const char* name, const PhaseJob& job) {
+        return phase(phases, name, job);
+    };
+
+    vector<string> all;
+    vector<string> users;
+    vector<string> accounts;
+    string issuer;
+    string issuerAcct;
+    string unit;
+
+    // Setup: any failure here leaves nothing to measure.
+    const bool ready =
+        step(
+            "newnym",
+            [&](cli::LatencyStats& stats) {
+                return createNyms("bench", nymCount, cores, all, stats);
+            }) &&
+        step(
+            "registernym",
+            [&](cli::LatencyStats& stats) {
+                return registerNyms(server, all, depth, stats);
+            }) &&
+        step(
+            "issueunit",
+            [&](cli::LatencyStats& stats) {
+                issuer = all.front();
+                users.assign(all.begin() + 1, all.end());
+                unit = issueUnit(server, issuer, "Bench", issuerAcct, stats);
+
+                return "" != unit;
+            }) &&
+        step(
+            "registeraccount",
+            [&](cli::LatencyStats& stats) {
+                return openAccounts(
+                    server, users, unit, depth, accounts, stats);
+            }) &&
+        step(
+            "addcontact",
+            [&](cli::LatencyStats& stats) {
+                return addContacts(users, stats);
+            }) &&
+        step("reservenumbers", [&](cli::LatencyStats& stats) {
+            return stats.Measure([&]() {
+                return reserveTransactionNumbers(server, issuer, 2 * count);
+            });
+        });
+
+    bool success{ready};
+
+    if (ready) {
+        const auto serverID = Identifier::Factory(server);
+        const int64_t timeSpan =
+            OTTimeGetSecondsFromTime(OT_TIME_MONTH_IN_SECONDS);
+
+        // Issuer accounts may go negative, so the issuer can fund every
+        // operation without a separate funding step.
+        success &= step("transfer", [&](cli::LatencyStats& stats) {
+            return sendTransfers(
+                server, issuer, issuerAcct, accounts, count, depth, stats);
+        });
+        success &= step("cheque", [&](cli::LatencyStats& stats) {
+            cli::Pipeline pipeline(depth);
+
+            for (size_t i = 0; i < count; ++i) {
+                pipeline.Add([&, i]() {
+                    return stats.Measure([&]() {
+                        const auto& hisnym = users[i % users.size()];
+                        const auto cheque = write_cheque(
+                            server,
+                            issuer,
+                            issuerAcct,
+                            hisnym,
+                            1,
+                            "bench",
+                            timeSpan,
+                            false);
+
+                        if ("" == cheque) { return false; }
+
+                        return 1 == payContact(cheque, issuer, hisnym);
+                    });
+                });
+            }
+
+            return 0 == pipeline.Run();
+        });
+        success &= step("processinbox", [&](cli::LatencyStats& stats) {
+            return processInboxes(server, users, accounts, depth, stats);
+        });
+        success &= step("depositcheques", [&](cli::LatencyStats& stats) {
+            cli::Pipeline pipeline(depth);
+
+            for (size_t i = 0; i < users.size(); ++i) {
+                pipeline.Add([&, i]() {
+                    return stats.Measure([&]() {
+                        const auto userID = Identifier::Factory(users[i]);
+                        auto& otx = Opentxs::Client().OTX();
+                        otx.DepositCheques(userID);
+
+                        // DepositCheques only queues the deposits.
+                        return cli::Stats::Wait(
+                            otx.ContextIdle(userID, serverID));
+                    });
+                });
+            }
+
+            return 0 == pipeline.Run();
+        });
+    }
+
+    if ("true" == json) {
+        cout << "{\"server\":\"" << server << "\",\"nyms\":" << nymCount
+             << ",\"ops\":" << count << ",\"phases\":";
+        writePhases(cout, phases, true);
+        cout << "}\n";
+    } else {
+        cout << "Server " << server << ", " << nymCount << " nyms, " << count
+             << " operations per type:\n";
+        writePhases(cout, phases, false);
+    }
+
+    return success ? 1 : -1;
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDBENCH_HPP
+#define OPENTXS_CLIENT_CMDBENCH_HPP
+
+#include "CmdBaseBench.hpp"
+
+#include <string>
+
+namespace opentxs
+{
+
+class CmdBench : public CmdBaseBench
+{
+public:
+    EXPORT CmdBench();
+    virtual ~CmdBench();
+
+    EXPORT int32_t
+    run(std::string server,
+        std::string instance,
+        std::string nyms,
+        std::string ops,
+        std::string inflight,
+        std::string json);
+
+protected:
+    std::int32_t runWithOptions() override;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDBENCH_HPP
@@ -0,0 +1,165 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdBenchNotary.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdBenchNotary::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdBenchNotary::CmdBenchNotary()
+{
+    command = "benchnotary";
+    args[0] = "[--server <server>]";
+    args[1] = "[--mynym <nym[,nym...]> (default all nyms)]";
+    args[2] = "[--count <pings> (default 100)]";
+    args[3] = "[--inflight <requests> (default 8, at most one per nym)]";
+    args[4] = "[--instance <server instance>]";
+    args[5] = "[--json <true|FALSE>]";
+    category = catMisc;
+    help = "Measure notary round trip latency with a batch of pings.";
+    usage = "Sends --count pings spread round robin over the nyms, and\n"
+            "reports latency percentiles, throughput and errors. A nym's\n"
+            "pings are serialized by its server context, so use several\n"
+            "nyms to get more than one request in flight. Use --instance\n"
+            "instead of --server to start an in-process notary and\n"
+            "benchmark against that, with no network involved.";
+}
+
+CmdBenchNotary::~CmdBenchNotary() {}
+
+int32_t CmdBenchNotary::runWithOptions()
+{
+    return run(
+        getOption("server"),
+        getOption("mynym"),
+        getOption("count"),
+        getOption("inflight"),
+        getOption("instance"),
+        getOption("json"));
+}
+
+bool CmdBenchNotary::ping(
+    const string& server,
+    const string& mynym,
+    cli::LatencyStats* stats) const
+{
+    auto context = Opentxs::Client().Wallet().mutable_ServerContext(
+        Identifier::Factory(mynym), Identifier::Factory(server));
+    // Start the clock only once the context is ours, so waiting for another
+    // ping on the same context doesn't count as notary latency.
+    const auto start = chrono::steady_clock::now();
+    const auto response = context.It().PingNotary();
+    const auto& reply = response.second;
+    const auto elapsed = chrono::duration_cast<cli::LatencyStats::Sample>(
+        chrono::steady_clock::now() - start);
+    const bool success = reply && reply->m_bSuccess;
+
+    if (nullptr == stats) { return success; }
+
+    if (success) {
+        stats->Add(elapsed);
+    } else {
+        stats->Error();
+    }
+
+    return success;
+}
+
+int32_t CmdBenchNotary::run(
+    string server,
+    string mynym,
+    string count,
+    string inflight,
+    string instance,
+    string json)
+{
+    if ("" != instance) {
+        if ("" != server) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: specify either --server or --instance.")
+                .Flush();
+            return -1;
+        }
+
+        if (!startNotary(instance, server)) { return -1; }
+    } else if (!checkServer("server", server)) {
+        return -1;
+    }
+
+    vector<string> nyms;
+
+    if ("" == mynym) {
+        const auto nymCount = SwigWrap::GetNymCount();
+
+        for (int32_t i = 0; i < nymCount; ++i) {
+            nyms.push_back(SwigWrap::GetNym_ID(i));
+        }
+    } else {
+        nyms = tokenize(mynym, ',', true);
+    }
+
+    if (nyms.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: no nyms to ping with.")
+            .Flush();
+        return -1;
+    }
+
+    for (auto& nym : nyms) {
+        if (!checkNym("mynym", nym)) { return -1; }
+    }
+
+    if ("" != count && !checkValue("count", count)) { return -1; }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    if ("" != json && !checkBoolean("json", json)) { return -1; }
+
+    const size_t pings = "" == count ? 100 : stoul(count);
+    // A context handles one request at a time, so pings beyond one per nym
+    // would only queue up behind each other.
+    const size_t depth = min<size_t>(
+        "" == inflight ? DEFAULT_IN_FLIGHT : stoul(inflight), nyms.size());
+
+    // The first request on a context also sets up the connection, so get
+    // that out of the way before anything is measured.
+    for (const auto& nym : nyms) {
+        if (!ping(server, nym, nullptr)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: nym ")(nym)(
+                " cannot ping server ")(server)(".")
+                .Flush();
+            return -1;
+        }
+    }
+
+    cli::LatencyStats stats;
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < pings; ++i) {
+        const auto& nym = nyms[i % nyms.size()];
+        pipeline.Add([this, &server, &nym, &stats]() {
+            return ping(server, nym, &stats);
+        });
+    }
+
+    const auto start = chrono::steady_clock::now();
+    pipeline.Run();
+    const auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - start);
+    stats.Write(cout, "pingnotary", elapsed, "true" == json);
+    cout << "\n";
+
+    return 0 == stats.Errors() ? 1 : -1;
+}
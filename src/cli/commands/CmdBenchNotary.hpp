@@ -0,0 +1,45 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDBENCHNOTARY_HPP
+#define OPENTXS_CLIENT_CMDBENCHNOTARY_HPP
+
+#include "CmdBase.hpp"
+
+#include "LatencyStats.hpp"
+
+#include <string>
+
+namespace opentxs
+{
+
+class CmdBenchNotary : public CmdBase
+{
+public:
+    EXPORT CmdBenchNotary();
+    virtual ~CmdBenchNotary();
+
+    EXPORT int32_t
+    run(std::string server,
+        std::string mynym,
+        std::string count,
+        std::string inflight,
+        std::string instance,
+        std::string json);
+
+protected:
+    std::int32_t runWithOptions() override;
+
+private:
+    // Sends one PingNotary and records how long the round trip took.
+    bool ping(
+        const std::string& server,
+        const std::string& mynym,
+        cli::LatencyStats* stats) const;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDBENCHNOTARY_HPP
@@ -71,12 +71,14 @@ int32_t CmdCheckNym::run(string server, string mynym, string hisnym)
 
      */
 
-    auto task = Opentxs::Client().OTX().DownloadNym(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(hisnym));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().DownloadNym(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(hisnym));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to download nym").Flush();
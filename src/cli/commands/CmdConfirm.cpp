@@ -64,7 +64,8 @@ int32_t CmdConfirm::run(
         return confirmInstrument(server, mynym, myacct, hisnym, instrument, -1);
     }
 
-    string inbox = SwigWrap::LoadPaymentInbox(server, mynym);
+    const string inbox = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadPaymentInbox(server, mynym); });
     if ("" == inbox) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment inbox.")
@@ -442,7 +443,7 @@ int32_t CmdConfirm::activateContract(
     auto task =
         Opentxs::Client().OTX().ProcessInbox(theNymID, theNotaryID, theAcctID);
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     const auto success = CmdBase::GetResultSuccess(result);
 
     if (false == success) {
@@ -520,10 +521,12 @@ int32_t CmdConfirm::sendToNextParty(
     const auto contactid =
         Opentxs::Client().Contacts().ContactID(Identifier::Factory(hisNymID));
 
-    auto task = Opentxs::Client().OTX().PayContact(
-        Identifier::Factory(mynym), contactid, ppayment);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PayContact(
+            Identifier::Factory(mynym), contactid, ppayment);
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
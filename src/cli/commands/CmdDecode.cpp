@@ -19,16 +19,35 @@ using namespace std;
 CmdDecode::CmdDecode()
 {
     command = "decode";
+    args[0] = "[--in <file>]";
+    args[1] = "[--out <file>]";
+    args[2] = "[--expect <file>]";
     category = catAdmin;
     help = "Decode OT-armored input text.";
+    usage = "With --in and --out, the file is decoded a chunk at a time, so\n"
+            "it can be of any size. It can hold the output of --out or\n"
+            "of the interactive command. --expect fails the command unless\n"
+            "the decoded file is identical to the given one.";
 }
 
 CmdDecode::~CmdDecode() {}
 
-int32_t CmdDecode::runWithOptions() { return run(); }
+int32_t CmdDecode::runWithOptions()
+{
+    return run(getOption("in"), getOption("out"), getOption("expect"));
+}
 
-int32_t CmdDecode::run()
+int32_t CmdDecode::run(string in, string out, string expect)
 {
+    if ("" != in || "" != out || "" != expect) {
+        return convertFile(
+            in,
+            out,
+            false,
+            [](const string& chunk) { return SwigWrap::Decode(chunk, true); },
+            expect);
+    }
+
     string input = inputText("the OT-armored text to be decoded");
     if ("" == input) { return -1; }
 
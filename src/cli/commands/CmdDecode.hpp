@@ -17,7 +17,7 @@ public:
     EXPORT CmdDecode();
     virtual ~CmdDecode();
 
-    EXPORT int32_t run();
+    EXPORT int32_t run(std::string in, std::string out, std::string expect);
 
 protected:
     virtual int32_t runWithOptions();
@@ -20,18 +20,43 @@ CmdDecrypt::CmdDecrypt()
 {
     command = "decrypt";
     args[0] = "--mynym <nym>";
+    args[1] = "[--in <file>]";
+    args[2] = "[--out <file>]";
+    args[3] = "[--expect <file>]";
     category = catAdmin;
     help = "Decrypt encrypted input text using mynym's private key.";
+    usage = "With --in and --out, the file is decrypted a chunk at a time, so\n"
+            "it can be of any size. It can hold the output of --out or\n"
+            "of the interactive command. --expect fails the command unless\n"
+            "the decrypted file is identical to the given one.";
 }
 
 CmdDecrypt::~CmdDecrypt() {}
 
-int32_t CmdDecrypt::runWithOptions() { return run(getOption("mynym")); }
+int32_t CmdDecrypt::runWithOptions()
+{
+    return run(
+        getOption("mynym"),
+        getOption("in"),
+        getOption("out"),
+        getOption("expect"));
+}
 
-int32_t CmdDecrypt::run(string mynym)
+int32_t CmdDecrypt::run(string mynym, string in, string out, string expect)
 {
     if (!checkNym("mynym", mynym)) { return -1; }
 
+    if ("" != in || "" != out || "" != expect) {
+        return convertFile(
+            in,
+            out,
+            false,
+            [&](const string& chunk) {
+                return SwigWrap::Decrypt(mynym, chunk);
+            },
+            expect);
+    }
+
     string input = inputText("the encrypted text to be decrypted");
     if ("" == input) { return -1; }
 
@@ -17,7 +17,11 @@ public:
     EXPORT CmdDecrypt();
     virtual ~CmdDecrypt();
 
-    EXPORT int32_t run(std::string mynym);
+    EXPORT int32_t run(
+        std::string mynym,
+        std::string in,
+        std::string out,
+        std::string expect);
 
 protected:
     virtual int32_t runWithOptions();
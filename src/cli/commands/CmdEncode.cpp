@@ -19,16 +19,30 @@ using namespace std;
 CmdEncode::CmdEncode()
 {
     command = "encode";
+    args[0] = "[--in <file>]";
+    args[1] = "[--out <file>]";
     category = catAdmin;
     help = "Encode plaintext input to OT-armored text.";
+    usage = "With --in and --out, the file is encoded a chunk at a time, so\n"
+            "it can be of any size. It must hold text: a file with a NUL\n"
+            "byte is rejected. Read the result back with --in.";
 }
 
 CmdEncode::~CmdEncode() {}
 
-int32_t CmdEncode::runWithOptions() { return run(); }
+int32_t CmdEncode::runWithOptions()
+{
+    return run(getOption("in"), getOption("out"));
+}
 
-int32_t CmdEncode::run()
+int32_t CmdEncode::run(string in, string out)
 {
+    if ("" != in || "" != out) {
+        return convertFile(in, out, true, [](const string& chunk) {
+            return SwigWrap::Encode(chunk, true);
+        });
+    }
+
     string input = inputText("the plaintext to be encoded");
     if ("" == input) { return -1; }
 
@@ -17,7 +17,7 @@ public:
     EXPORT CmdEncode();
     virtual ~CmdEncode();
 
-    EXPORT int32_t run();
+    EXPORT int32_t run(std::string in, std::string out);
 
 protected:
     virtual int32_t runWithOptions();
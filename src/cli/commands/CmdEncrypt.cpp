@@ -20,18 +20,32 @@ CmdEncrypt::CmdEncrypt()
 {
     command = "encrypt";
     args[0] = "--hisnym <nym>";
+    args[1] = "[--in <file>]";
+    args[2] = "[--out <file>]";
     category = catAdmin;
     help = "Encrypt plaintext input using hisnym's public key.";
+    usage = "With --in and --out, the file is encrypted a chunk at a time, so\n"
+            "it can be of any size. It must hold text: a file with a NUL\n"
+            "byte is rejected. Read the result back with --in.";
 }
 
 CmdEncrypt::~CmdEncrypt() {}
 
-int32_t CmdEncrypt::runWithOptions() { return run(getOption("hisnym")); }
+int32_t CmdEncrypt::runWithOptions()
+{
+    return run(getOption("hisnym"), getOption("in"), getOption("out"));
+}
 
-int32_t CmdEncrypt::run(string hisnym)
+int32_t CmdEncrypt::run(string hisnym, string in, string out)
 {
     if (!checkNym("hisnym", hisnym)) { return -1; }
 
+    if ("" != in || "" != out) {
+        return convertFile(in, out, true, [&](const string& chunk) {
+            return SwigWrap::Encrypt(hisnym, chunk);
+        });
+    }
+
     string input = inputText("the plaintext to be encrypted");
     if ("" == input) { return -1; }
 
@@ -17,7 +17,7 @@ public:
     EXPORT CmdEncrypt();
     virtual ~CmdEncrypt();
 
-    EXPORT int32_t run(std::string hisnym);
+    EXPORT int32_t run(std::string hisnym, std::string in, std::string out);
 
 protected:
     virtual int32_t runWithOptions();
@@ -263,7 +263,7 @@ int32_t CmdExchangeBasket::run(string myacct, string direction, string multiple)
     auto task =
         Opentxs::Client().OTX().ProcessInbox(theNymID, theNotaryID, theAcctID);
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
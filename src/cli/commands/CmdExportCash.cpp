@@ -136,12 +136,14 @@ string CmdExportCash::exportCash(
     std::string strContract = SwigWrap::GetAssetType_Contract(assetType);
 
     if (!VerifyStringVal(strContract)) {
-        auto task = Opentxs::Client().OTX().DownloadContract(
-            Identifier::Factory(mynym),
-            Identifier::Factory(server),
-            Identifier::Factory(assetType));
-
-        const auto result = std::get<1>(task).get();
+        auto task = cli::Stats::Submit([&]() {
+            return Opentxs::Client().OTX().DownloadContract(
+                Identifier::Factory(mynym),
+                Identifier::Factory(server),
+                Identifier::Factory(assetType));
+        });
+
+        const auto result = cli::Stats::Wait(std::get<1>(task));
 
         const auto success = CmdBase::GetResultSuccess(result);
         if (success) {
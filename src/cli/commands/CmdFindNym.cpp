@@ -23,9 +23,11 @@ std::int32_t CmdFindNym::run(std::string hisnym)
 {
     if (!checkNym("hisnym", hisnym, false)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().FindNym(Identifier::Factory(hisnym));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().FindNym(Identifier::Factory(hisnym));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     const auto success = CmdBase::GetResultSuccess(result);
     if (success) { return 1; }
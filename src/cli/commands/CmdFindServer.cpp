@@ -24,9 +24,11 @@ std::int32_t CmdFindServer::runWithOptions()
 
 std::int32_t CmdFindServer::run(std::string server)
 {
-    auto task = Opentxs::Client().OTX().FindServer(Identifier::Factory(server));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().FindServer(Identifier::Factory(server));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) { return -1; }
@@ -0,0 +1,293 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdGenerateWallet.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdGenerateWallet::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdGenerateWallet::CmdGenerateWallet()
+{
+    command = "generatewallet";
+    args[0] = "[--server <server>]";
+    args[1] = "[--instance <server instance>]";
+    args[2] = "[--nyms <count> (default 10)]";
+    args[3] = "[--units <accounts per nym> (default 1)]";
+    args[4] = "[--contacts <count>]";
+    args[5] = "[--messages <count>]";
+    args[6] = "[--receipts <count>]";
+    args[7] = "[--records <count>]";
+    args[8] = "[--inflight <requests> (default 8)]";
+    category = catMisc;
+    help = "Fill the wallet with synthetic data for scale testing.";
+    usage = "Creates and registers --nyms holder nyms plus an issuer, which\n"
+            "issues --units units; every holder opens an account for each\n"
+            "unit. Then adds --contacts extra contacts, sends --messages\n"
+            "mail messages from the issuer, and --records transfers that\n"
+            "are accepted (leaving record box entries) followed by\n"
+            "--receipts transfers that stay in the holders' inboxes.\n"
+            "Use --instance to generate against an in-process notary.";
+}
+
+CmdGenerateWallet::~CmdGenerateWallet() {}
+
+int32_t CmdGenerateWallet::runWithOptions()
+{
+    return run(
+        getOption("server"),
+        getOption("instance"),
+        getOption("nyms"),
+        getOption("units"),
+        getOption("contacts"),
+        getOption("messages"),
+        getOption("receipts"),
+        getOption("records"),
+        getOption("inflight"));
+}
+
+bool CmdGenerateWallet::new_contacts(size_t count, cli::LatencyStats& stats)
+    const
+{
+    bool output{true};
+
+    for (size_t i = 0; i < count; ++i) {
+        output &= stats.Measure([&]() {
+            return bool(Opentxs::Client().Contacts().NewContact(
+                "Generated contact " + to_string(i)));
+        });
+    }
+
+    return output;
+}
+
+bool CmdGenerateWallet::send_messages(
+    const string& mynym,
+    const vector<string>& to,
+    size_t count,
+    size_t depth,
+    cli::LatencyStats& stats) const
+{
+    if (to.empty()) { return 0 == count; }
+
+    const auto nymID = Identifier::Factory(mynym);
+    cli::Pipeline pipeline(depth);
+
+    for (size_t i = 0; i < count; ++i) {
+        pipeline.Add([&, i]() {
+            return stats.Measure([&]() {
+                const auto contactID = Opentxs::Client().Contacts().ContactID(
+                    Identifier::Factory(to[i % to.size()]));
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().MessageContact(
+                        nymID, contactID, "Generated message " + to_string(i));
+                });
+
+                return CmdBase::GetResultSuccess(
+                    cli::Stats::Wait(get<1>(task)));
+            });
+        });
+    }
+
+    return 0 == pipeline.Run();
+}
+
+bool CmdGenerateWallet::send_transfers(
+    const string& server,
+    const string& issuer,
+    const vector<string>& issuerAccounts,
+    const vector<vector<string>>& accounts,
+    size_t count,
+    size_t depth,
+    cli::LatencyStats& stats) const
+{
+    const auto units = issuerAccounts.size();
+    bool output{true};
+
+    for (size_t u = 0; u < units; ++u) {
+        const auto share = count / units + (u < count % units ? 1 : 0);
+        output &= sendTransfers(
+            server,
+            issuer,
+            issuerAccounts[u],
+            accounts[u],
+            share,
+            depth,
+            stats);
+    }
+
+    return output;
+}
+
+int32_t CmdGenerateWallet::run(
+    string server,
+    string instance,
+    string nyms,
+    string units,
+    string contacts,
+    string messages,
+    string receipts,
+    string records,
+    string inflight)
+{
+    if ("" != instance) {
+        if ("" != server) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: specify either --server or --instance.")
+                .Flush();
+            return -1;
+        }
+    } else if (!checkServer("server", server)) {
+        return -1;
+    }
+
+    if ("" != nyms && !checkValue("nyms", nyms)) { return -1; }
+
+    if ("" != units && !checkValue("units", units)) { return -1; }
+
+    if ("" != contacts && !checkValue("contacts", contacts)) { return -1; }
+
+    if ("" != messages && !checkValue("messages", messages)) { return -1; }
+
+    if ("" != receipts && !checkValue("receipts", receipts)) { return -1; }
+
+    if ("" != records && !checkValue("records", records)) { return -1; }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    const size_t nymCount = "" == nyms ? 10 : stoul(nyms);
+    const size_t unitCount = "" == units ? 1 : stoul(units);
+    const size_t contactCount = "" == contacts ? 0 : stoul(contacts);
+    const size_t messageCount = "" == messages ? 0 : stoul(messages);
+    const size_t receiptCount = "" == receipts ? 0 : stoul(receipts);
+    const size_t recordCount = "" == records ? 0 : stoul(records);
+    const size_t depth = "" == inflight ? DEFAULT_IN_FLIGHT : stoul(inflight);
+    const size_t cores = max<size_t>(thread::hardware_concurrency(), 1);
+
+    if (0 == nymCount || 0 == unitCount) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: need at least one nym and one unit.")
+            .Flush();
+        return -1;
+    }
+
+    if ("" != instance && !startNotary(instance, server)) { return -1; }
+
+    Phases phases;
+    auto step = [&](const char* name, const PhaseJob& job) {
+        return phase(phases, name, job);
+    };
+
+    vector<string> issuers;
+    vector<string> holders;
+    vector<string> issuerAccounts(unitCount);
+    vector<vector<string>> accounts(unitCount);
+    // Every holder account alongside its owner, for processing inboxes.
+    vector<string> owners;
+    vector<string> ownedAccounts;
+
+    const bool success =
+        step(
+            "newnym",
+            [&](cli::LatencyStats& stats) {
+                return createNyms("Issuer", 1, 1, issuers, stats) &&
+                       createNyms("Holder", nymCount, cores, holders, stats);
+            }) &&
+        step(
+            "registernym",
+            [&](cli::LatencyStats& stats) {
+                return registerNyms(server, issuers, 1, stats) &&
+                       registerNyms(server, holders, depth, stats);
+            }) &&
+        step(
+            "issueunit",
+            [&](cli::LatencyStats& stats) {
+                for (size_t u = 0; u < unitCount; ++u) {
+                    const auto unit = issueUnit(
+                        server,
+                        issuers.front(),
+                        "Generated " + to_string(u),
+                        issuerAccounts[u],
+                        stats);
+
+                    if ("" == unit) { return false; }
+
+                    if (!openAccounts(
+                            server, holders, unit, depth, accounts[u], stats)) {
+                        return false;
+                    }
+
+                    owners.insert(owners.end(), holders.begin(), holders.end());
+                    ownedAccounts.insert(
+                        ownedAccounts.end(),
+                        accounts[u].begin(),
+                        accounts[u].end());
+                }
+
+                return true;
+            }) &&
+        step(
+            "addcontact",
+            [&](cli::LatencyStats& stats) {
+                return addContacts(holders, stats) &&
+                       new_contacts(contactCount, stats);
+            }) &&
+        step(
+            "message",
+            [&](cli::LatencyStats& stats) {
+                return send_messages(
+                    issuers.front(), holders, messageCount, depth, stats);
+            }) &&
+        step(
+            "reservenumbers",
+            [&](cli::LatencyStats& stats) {
+                return stats.Measure([&]() {
+                    return reserveTransactionNumbers(
+                        server, issuers.front(), recordCount + receiptCount);
+                });
+            }) &&
+        step(
+            "record",
+            [&](cli::LatencyStats& stats) {
+                return send_transfers(
+                           server,
+                           issuers.front(),
+                           issuerAccounts,
+                           accounts,
+                           recordCount,
+                           depth,
+                           stats) &&
+                       (0 == recordCount ||
+                        processInboxes(
+                            server, owners, ownedAccounts, depth, stats));
+            }) &&
+        step("receipt", [&](cli::LatencyStats& stats) {
+            return send_transfers(
+                server,
+                issuers.front(),
+                issuerAccounts,
+                accounts,
+                receiptCount,
+                depth,
+                stats);
+        });
+
+    cout << "Server " << server << ": " << issuers.size() + holders.size()
+         << " nyms, " << ownedAccounts.size() + unitCount << " accounts.\n";
+    writePhases(cout, phases, false);
+
+    return success ? 1 : -1;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDGENERATEWALLET_HPP
+#define OPENTXS_CLIENT_CMDGENERATEWALLET_HPP
+
+#include "CmdBaseBench.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+class CmdGenerateWallet : public CmdBaseBench
+{
+public:
+    EXPORT CmdGenerateWallet();
+    virtual ~CmdGenerateWallet();
+
+    EXPORT int32_t
+    run(std::string server,
+        std::string instance,
+        std::string nyms,
+        std::string units,
+        std::string contacts,
+        std::string messages,
+        std::string receipts,
+        std::string records,
+        std::string inflight);
+
+protected:
+    std::int32_t runWithOptions() override;
+
+private:
+    bool new_contacts(std::size_t count, cli::LatencyStats& stats) const;
+    bool send_messages(
+        const std::string& mynym,
+        const std::vector<std::string>& to,
+        std::size_t count,
+        std::size_t depth,
+        cli::LatencyStats& stats) const;
+    // Spreads count transfers over the units, each from the issuer account
+    // to the holders' accounts of the same unit.
+    bool send_transfers(
+        const std::string& server,
+        const std::string& issuer,
+        const std::vector<std::string>& issuerAccounts,
+        const std::vector<std::vector<std::string>>& accounts,
+        std::size_t count,
+        std::size_t depth,
+        cli::LatencyStats& stats) const;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDGENERATEWALLET_HPP
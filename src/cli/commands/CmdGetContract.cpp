@@ -43,12 +43,14 @@ int32_t CmdGetInstrumentDefinition::run(
 
     if (!checkMandatory("contract", contract)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().DownloadContract(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(contract));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().DownloadContract(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(contract));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
@@ -5,6 +5,7 @@
 
 #include "CmdGetMarkets.hpp"
 #include "CmdShowMarkets.hpp"
+#include "MarketIndex.hpp"
 
 #include <opentxs/opentxs.hpp>
 
@@ -54,6 +55,12 @@ int32_t CmdGetMarkets::run(string server, string mynym)
         return -1;
     }
 
+    if (!cli::MarketIndex::Rebuild(server)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot index market list.")
+            .Flush();
+    }
+
     CmdShowMarkets showMarkets;
-    return showMarkets.run(server);
+    return showMarkets.run(server, "");
 }
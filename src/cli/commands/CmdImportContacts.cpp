@@ -0,0 +1,231 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdImportContacts.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdImportContacts::"
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Import {
+    std::size_t line_{0};
+    string hisnym_;
+    string label_;
+    string nymID_;
+    bool paymentCode_{false};
+    bool lookup_{false};
+};
+}  // namespace
+
+CmdImportContacts::CmdImportContacts()
+{
+    command = "importcontacts";
+    args[0] = "--file <csvfile>";
+    args[1] = "[--server <server>]";
+    args[2] = "[--mynym <nym>]";
+    args[3] = "[--inflight <requests> (default 8)]";
+    category = catOtherUsers;
+    help = "Add the contacts listed in a file.";
+    usage = "Each line of the file holds: hisnym[,label]\n"
+            "hisnym is a nym id or a payment code. Duplicate lines and nyms\n"
+            "which already are contacts are skipped. Nyms not in the wallet\n"
+            "are downloaded first: from --server as --mynym if both are\n"
+            "given, otherwise by searching every known server.";
+}
+
+CmdImportContacts::~CmdImportContacts() {}
+
+int32_t CmdImportContacts::runWithOptions()
+{
+    return run(
+        getOption("file"),
+        getOption("server"),
+        getOption("mynym"),
+        getOption("inflight"));
+}
+
+int32_t CmdImportContacts::run(
+    string file,
+    string server,
+    string mynym,
+    string inflight)
+{
+    if ("" != server && !checkServer("server", server)) { return -1; }
+
+    if ("" != mynym && !checkNym("mynym", mynym)) { return -1; }
+
+    if (("" == server) != ("" == mynym)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: specify both --server and --mynym, or neither.")
+            .Flush();
+        return -1;
+    }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    CsvRows rows;
+
+    if (!loadCsv("file", file, 2, rows)) { return -1; }
+
+    if (rows.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The file is empty.").Flush();
+        return 0;
+    }
+
+    auto& client = Opentxs::Client();
+    vector<Import> imports;
+    set<string> seen;
+    std::size_t invalid{0};
+    std::size_t duplicates{0};
+    std::size_t known{0};
+
+    for (const auto& row : rows) {
+        const auto& fields = row.second;
+        Import entry;
+        entry.line_ = row.first;
+        entry.hisnym_ = fields[0];
+
+        if (1 < fields.size()) { entry.label_ = fields[1]; }
+
+        auto nymID = Identifier::Factory(entry.hisnym_);
+        const auto code = client.Factory().PaymentCode(entry.hisnym_);
+        entry.paymentCode_ = code->VerifyInternally();
+
+        if (nymID->empty() && entry.paymentCode_) { nymID = code->ID(); }
+
+        if (nymID->empty()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": not a nym id or payment code.")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        entry.nymID_ = nymID->str();
+
+        if (false == seen.insert(entry.nymID_).second) {
+            ++duplicates;
+            continue;
+        }
+
+        if (false == client.Contacts().ContactID(nymID)->empty()) {
+            ++known;
+            continue;
+        }
+
+        entry.lookup_ = (nullptr == client.Wallet().Nym(nymID));
+        imports.push_back(std::move(entry));
+    }
+
+    if (0 < invalid) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(invalid)(
+            " invalid lines. Nothing was imported.")
+            .Flush();
+        return -1;
+    }
+
+    if (imports.empty()) {
+        cout << "Nothing to import (" << duplicates << " duplicates, "
+             << known << " already contacts).\n";
+        return 0;
+    }
+
+    const std::size_t depth =
+        "" == inflight ? DEFAULT_IN_FLIGHT : std::stoul(inflight);
+    const auto start = std::chrono::steady_clock::now();
+    // Index into imports of each pipeline job.
+    vector<std::size_t> lookups;
+    cli::Pipeline pipeline(depth);
+
+    for (std::size_t i = 0; i < imports.size(); ++i) {
+        if (false == imports[i].lookup_) { continue; }
+
+        lookups.push_back(i);
+        pipeline.Add([&, i]() -> bool {
+            const auto& entry = imports[i];
+            auto task = cli::Stats::Submit([&]() {
+                if ("" == server) {
+                    return client.OTX().FindNym(
+                        Identifier::Factory(entry.nymID_));
+                }
+
+                return client.OTX().DownloadNym(
+                    Identifier::Factory(mynym),
+                    Identifier::Factory(server),
+                    Identifier::Factory(entry.nymID_));
+            });
+
+            return CmdBase::GetResultSuccess(
+                cli::Stats::Wait(std::get<1>(task)));
+        });
+    }
+
+    if (0 < pipeline.size()) {
+        const auto step = std::max<std::size_t>(pipeline.size() / 10, 1);
+        pipeline.Run(
+            [step](std::size_t done, std::size_t errors, std::size_t total) {
+                if (0 == done % step || done == total) {
+                    cout << done << "/" << total << " nyms looked up, "
+                         << errors << " not found.\n";
+                }
+            });
+    }
+
+    set<std::size_t> notFound;
+
+    for (std::size_t i = 0; i < lookups.size(); ++i) {
+        if (false == pipeline.Succeeded(i)) { notFound.insert(lookups[i]); }
+    }
+
+    // Contacts are added once every lookup has finished, so they don't
+    // contend with the lookups.
+    std::size_t added{0};
+    std::size_t failed{0};
+
+    for (std::size_t i = 0; i < imports.size(); ++i) {
+        const auto& entry = imports[i];
+
+        // A payment code is enough to create a usable contact, a bare nym
+        // id which couldn't be found is not.
+        if (1 == notFound.count(i) && false == entry.paymentCode_) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(
+                entry.line_)(": nym ")(entry.nymID_)(" not found.")
+                .Flush();
+            ++failed;
+            continue;
+        }
+
+        if (addContact(entry.label_, entry.nymID_, entry.hisnym_)) {
+            ++added;
+        } else {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(
+                entry.line_)(": cannot create contact.")
+                .Flush();
+            ++failed;
+        }
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    cout << "Added " << added << " of " << imports.size() << " contacts ("
+         << duplicates << " duplicates, " << known << " already contacts, "
+         << failed << " failed) in " << elapsed.count() << " ms.\n";
+
+    return 0 == failed ? 1 : -1;
+}
@@ -48,7 +48,8 @@ int32_t CmdInbox::run(string myacct)
         return -1;
     }
 
-    string inbox = SwigWrap::LoadInbox(server, mynym, myacct);
+    const string inbox = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadInbox(server, mynym, myacct); });
     if ("" == inbox) {
         LogNormal(OT_METHOD)(__FUNCTION__)(" : Error: cannot load inbox.")
             .Flush();
@@ -68,6 +69,8 @@ int32_t CmdInbox::run(string myacct)
         return 0;
     }
 
+    cli::Stats::Scope scope("render");
+
     cout << "Show inbox for an asset account  (" << myacct << "): \n"
          << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
          << "---------------------------------|(from or to)\n";
@@ -38,7 +38,8 @@ int32_t CmdInpayments::run(string server, string mynym)
 
     if (!checkNym("mynym", mynym)) { return -1; }
 
-    string inbox = SwigWrap::LoadPaymentInbox(server, mynym);
+    const string inbox = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadPaymentInbox(server, mynym); });
     if ("" == inbox) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment inbox.")
@@ -60,6 +61,8 @@ int32_t CmdInpayments::run(string server, string mynym)
         return 0;
     }
 
+    cli::Stats::Scope scope("render");
+
     cout << "Show payments inbox (Nym/Server)\n( " << mynym << " / " << server
          << " )\n";
     cout << "Idx  Amt   Type      Txn#  Asset_Type\n";
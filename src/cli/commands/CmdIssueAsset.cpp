@@ -50,12 +50,14 @@ int32_t CmdIssueAsset::run(
 
     if (false == bool(contract)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().IssueUnitDefinition(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        contract->ID());
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().IssueUnitDefinition(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            contract->ID());
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
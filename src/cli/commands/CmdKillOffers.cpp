@@ -0,0 +1,165 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdKillOffers.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+
+#define OT_METHOD "opentxs::CmdKillOffers::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdKillOffers::CmdKillOffers()
+{
+    command = "killoffers";
+    args[0] = "--server <server>";
+    args[1] = "--mynym <nym>";
+    args[2] = "[--myacct <assetaccount>]";
+    args[3] = "[--hisacct <currencyaccount>]";
+    args[4] = "[--type <ask|bid>]";
+    args[5] = "[--minprice <price>]";
+    args[6] = "[--maxprice <price>]";
+    args[7] = "[--all <true|false>]";
+    args[8] = "[--inflight <requests> (default 8)]";
+    category = catMarkets;
+    help = "Kill all of mynym's market offers matching a filter.";
+    usage = "Specify at least one filter, or --all true to kill every offer.\n"
+            "myacct and hisacct select the market, type the side, and\n"
+            "minprice/maxprice an inclusive price range.";
+}
+
+CmdKillOffers::~CmdKillOffers() {}
+
+int32_t CmdKillOffers::runWithOptions()
+{
+    return run(
+        getOption("server"),
+        getOption("mynym"),
+        getOption("myacct"),
+        getOption("hisacct"),
+        getOption("type"),
+        getOption("minprice"),
+        getOption("maxprice"),
+        getOption("all"),
+        getOption("inflight"));
+}
+
+int32_t CmdKillOffers::run(
+    string server,
+    string mynym,
+    string myacct,
+    string hisacct,
+    string type,
+    string minprice,
+    string maxprice,
+    string all,
+    string inflight)
+{
+    if (!checkServer("server", server)) { return -1; }
+
+    if (!checkNym("mynym", mynym)) { return -1; }
+
+    if ("" != myacct && !checkAccount("myacct", myacct)) { return -1; }
+
+    if ("" != hisacct && !checkAccount("hisacct", hisacct)) { return -1; }
+
+    if ("" != type && type != "ask" && type != "bid") {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: type: expected ask or bid.")
+            .Flush();
+        return -1;
+    }
+
+    if ("" != minprice && !checkValue("minprice", minprice)) { return -1; }
+
+    if ("" != maxprice && !checkValue("maxprice", maxprice)) { return -1; }
+
+    if ("" != all && !checkFlag("all", all)) { return -1; }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    const bool killAll = "true" == all;
+    const bool filtered = "" != myacct || "" != hisacct || "" != type ||
+                          "" != minprice || "" != maxprice;
+
+    if (!killAll && !filtered) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: specify a filter, or --all true to kill every offer.")
+            .Flush();
+        return -1;
+    }
+
+    const std::string response =
+        Opentxs::Client()
+            .ServerAction()
+            .DownloadNymMarketOffers(
+                Identifier::Factory(mynym), Identifier::Factory(server))
+            ->Run();
+    if (1 != responseStatus(response)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: cannot download market offer list.")
+            .Flush();
+        return -1;
+    }
+
+    std::unique_ptr<OTDB::OfferListNym> offerList{
+        loadNymOffers(server, mynym)};
+    if (!offerList) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The offer list is empty.")
+            .Flush();
+        return 0;
+    }
+
+    const cli::OfferIndex index(*offerList);
+    const auto offers = index.Select(
+        myacct,
+        hisacct,
+        type,
+        "" == minprice ? std::numeric_limits<std::int64_t>::min()
+                       : stoll(minprice),
+        "" == maxprice ? std::numeric_limits<std::int64_t>::max()
+                       : stoll(maxprice));
+
+    if (offers.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": No matching offers.").Flush();
+        return 0;
+    }
+
+    const std::size_t depth =
+        "" == inflight ? DEFAULT_IN_FLIGHT : std::stoul(inflight);
+    const std::size_t step = std::max<std::size_t>(offers.size() / 10, 1);
+    const auto start = std::chrono::steady_clock::now();
+
+    cout << "Killing " << offers.size() << " of " << index.size()
+         << " offers with up to " << depth << " requests in flight.\n";
+
+    const auto failed = killMarketOffers(
+        server,
+        mynym,
+        offers,
+        depth,
+        [step](std::size_t done, std::size_t errors, std::size_t total) {
+            if (0 == done % step || done == total) {
+                cout << done << "/" << total << " processed, " << errors
+                     << " failed.\n";
+            }
+        });
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    cout << "Killed " << offers.size() - failed << " offers, " << failed
+         << " failed, in " << elapsed.count() << " ms.\n";
+
+    return 0 == failed ? 1 : -1;
+}
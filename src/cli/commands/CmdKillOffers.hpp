@@ -0,0 +1,37 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDKILLOFFERS_HPP
+#define OPENTXS_CLIENT_CMDKILLOFFERS_HPP
+
+#include "CmdBase.hpp"
+
+namespace opentxs
+{
+
+class CmdKillOffers : public CmdBase
+{
+public:
+    EXPORT CmdKillOffers();
+    virtual ~CmdKillOffers();
+
+    EXPORT int32_t
+    run(std::string server,
+        std::string mynym,
+        std::string myacct,
+        std::string hisacct,
+        std::string type,
+        std::string minprice,
+        std::string maxprice,
+        std::string all,
+        std::string inflight);
+
+protected:
+    std::int32_t runWithOptions() override;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDKILLOFFERS_HPP
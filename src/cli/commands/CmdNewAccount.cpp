@@ -46,12 +46,14 @@ int32_t CmdNewAccount::run(string server, string mynym, string mypurse)
         registerNym.run(server, mynym, "true", "false");
     }
 
-    auto task = Opentxs::Client().OTX().RegisterAccount(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(mypurse));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().RegisterAccount(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(mypurse));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
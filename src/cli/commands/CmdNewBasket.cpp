@@ -183,12 +183,14 @@ int32_t CmdNewBasket::run(
             bool bRetrieved = false;
 
             if (bGotNewID) {
-                auto task = Opentxs::Client().OTX().DownloadContract(
-                    Identifier::Factory(mynym),
-                    Identifier::Factory(server),
-                    Identifier::Factory(strNewID));
-
-                const auto result = std::get<1>(task).get();
+                auto task = cli::Stats::Submit([&]() {
+                    return Opentxs::Client().OTX().DownloadContract(
+                        Identifier::Factory(mynym),
+                        Identifier::Factory(server),
+                        Identifier::Factory(strNewID));
+                });
+
+                const auto result = cli::Stats::Wait(std::get<1>(task));
                 const auto success =
                     CmdBase::GetResultSuccess(result);
 
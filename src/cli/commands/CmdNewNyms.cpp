@@ -0,0 +1,134 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdNewNyms.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdNewNyms::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdNewNyms::CmdNewNyms()
+{
+    command = "newnyms";
+    args[0] = "--count <nyms>";
+    args[1] = "[--threads <threads> (default one per core; needs --index)]";
+    args[2] = "[--label <label> (default nym)]";
+    args[3] = "[--source <seed fingerprint,...>]";
+    args[4] = "[--index <first HD derivation path>]";
+    args[5] = "[--json <true|FALSE>]";
+    category = catNyms;
+    help = "Create many nyms using HD key derivation, in parallel.";
+    usage = "Prints the ids of the new nyms, labeled \"<label> <n>\", then\n"
+            "the creation rate and latency percentiles. Nyms are derived\n"
+            "round robin from the --source seeds (by default the wallet's\n"
+            "seed). With --index, each seed's nyms use consecutive paths\n"
+            "starting there; otherwise each seed's next free path, which\n"
+            "has to be claimed one nym at a time, so only --index derives\n"
+            "nyms in parallel.";
+}
+
+CmdNewNyms::~CmdNewNyms() {}
+
+int32_t CmdNewNyms::runWithOptions()
+{
+    return run(
+        getOption("count"),
+        getOption("threads"),
+        getOption("label"),
+        getOption("source"),
+        getOption("index"),
+        getOption("json"));
+}
+
+int32_t CmdNewNyms::run(
+    string count,
+    string threads,
+    string label,
+    string source,
+    string index,
+    string json)
+{
+    if (!checkValue("count", count)) { return -1; }
+
+    if ("" != threads && !checkValue("threads", threads)) { return -1; }
+
+    if ("" != index && !checkValue("index", index)) { return -1; }
+
+    if ("" != json && !checkBoolean("json", json)) { return -1; }
+
+    const size_t nymCount = stoul(count);
+    const size_t cores = max<size_t>(thread::hardware_concurrency(), 1);
+    const size_t depth = "" == threads ? cores : stoul(threads);
+    const int32_t path = "" == index ? -1 : stol(index);
+    auto seeds = tokenize(source, ',', true);
+
+    if (seeds.empty()) { seeds.push_back(""); }
+
+    if ("" == label) { label = "nym"; }
+
+    // Without --index each nym has to claim its seed's next free path in
+    // turn (see createNyms), so only --index runs in parallel.
+    const size_t parallel = (0 > path) ? 1 : depth;
+
+    if ((0 > path) && ("" != threads)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Without --index nyms are created one at a time; --threads is "
+            "ignored.")
+            .Flush();
+    }
+
+    Phases phases;
+    vector<string> nyms;
+    // The client creates, signs and saves a nym in one call, so derivation,
+    // credential signing and storage can't be timed separately.
+    const bool success =
+        phase(phases, "newnym", [&](cli::LatencyStats& stats) {
+            return createNyms(
+                label, seeds, path, nymCount, parallel, nyms, stats);
+        });
+
+    if (!success) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot create every nym.")
+            .Flush();
+    }
+
+    if ("true" == json) {
+        cout << "{\"threads\":" << parallel << ",\"nyms\":[";
+
+        for (size_t i = 0; i < nyms.size(); ++i) {
+            if (0 < i) { cout << ","; }
+
+            cout << "\"" << nyms[i] << "\"";
+        }
+
+        cout << "],\"phases\":";
+        writePhases(cout, phases, true);
+        cout << "}\n";
+    } else {
+        for (const auto& nym : nyms) {
+            if ("" != nym) { cout << nym << "\n"; }
+        }
+
+        if (0 > path) {
+            cout << nymCount << " nyms, one at a time (only --index runs in "
+                 << "parallel):\n";
+        } else {
+            cout << nymCount << " nyms on " << parallel << " threads:\n";
+        }
+        writePhases(cout, phases, false);
+    }
+
+    return success ? 1 : -1;
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDNEWNYMS_HPP
+#define OPENTXS_CLIENT_CMDNEWNYMS_HPP
+
+#include "CmdBaseBench.hpp"
+
+namespace opentxs
+{
+
+class CmdNewNyms : public CmdBaseBench
+{
+public:
+    EXPORT CmdNewNyms();
+    virtual ~CmdNewNyms();
+
+    EXPORT int32_t
+    run(std::string count,
+        std::string threads,
+        std::string label,
+        std::string source,
+        std::string index,
+        std::string json);
+
+protected:
+    std::int32_t runWithOptions() override;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDNEWNYMS_HPP
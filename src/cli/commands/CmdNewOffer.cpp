@@ -10,6 +10,7 @@
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -126,16 +127,10 @@ int32_t CmdNewOffer::run(
         return -1;
     }
 
-    // NOTE: Removing this for now. It was a special feature for
-    // knotwork and currently it's causing me some problems.
-    //
-    //    Opentxs::Client().OTME().get_nym_market_offers(server, mynym);
-    //
-    //    if (0 > cleanMarketOfferList(server, mynym, myacct, hisacct, type,
-    //    scale,
-    //                                 price)) {
-    //        return -1;
-    //    }
+    if (0 > cleanMarketOfferList(
+                server, mynym, myacct, hisacct, type, scale, price)) {
+        return -1;
+    }
 
     // OKAY! Now that we've cleaned out any undesirable offers, let's place the
     // the offer itself!
@@ -208,94 +203,59 @@ int32_t CmdNewOffer::cleanMarketOfferList(
     const string& scale,
     const string& price)
 {
-    OTDB::OfferListNym* offerList = loadNymOffers(server, mynym);
-    if (nullptr == offerList) {
+    // Make sure we're looking at the offers the server actually has, not
+    // whatever was on disk from the last time they were downloaded.
+    const std::string response =
+        Opentxs::Client()
+            .ServerAction()
+            .DownloadNymMarketOffers(
+                Identifier::Factory(mynym), Identifier::Factory(server))
+            ->Run();
+    if (1 != responseStatus(response)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot load market offer list.")
+            ": Error: cannot download market offer list.")
             .Flush();
         return -1;
     }
 
-    // LOOP THROUGH THE OFFERS and sort them into a map_of_maps, key is:
-    // scale-instrumentDefinitionID-currencyID. the value for each key is a
-    // sub-map, with
-    // the key: transaction ID and value: the offer data itself.
-    int32_t items = offerList->GetOfferDataNymCount();
-    if (0 > items) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot load market offer list count.")
+    std::unique_ptr<OTDB::OfferListNym> offerList{
+        loadNymOffers(server, mynym)};
+    if (!offerList) {
+        // No offers file means there are no offers to cancel.
+        LogDetail(OT_METHOD)(__FUNCTION__)(": The market offer list is empty.")
             .Flush();
-        return -1;
+        return 0;
     }
 
-    if (0 == items) {
+    const cli::OfferIndex index(*offerList);
+
+    if (0 == index.size()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": The market offer list is empty.")
             .Flush();
         return 0;
     }
 
-    MapOfMaps* map_of_maps = convert_offerlist_to_maps(*offerList);
-    if (nullptr == map_of_maps) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot convert offer list to map.")
-            .Flush();
-        return -1;
-    }
-    // (FT) TODO: Fix this ridiculous memory leak. map_of_maps is not
-    // cleaned up below this point. (Nor are its member pointers and their
-    // contents. unique_ptr is not enough.) I think the only reason Eric
-    // let this go was because the program ends anyway after the command
-    // fires. Still, needs cleanup.
-
-    // find_strange_offers is called for each offer, for this nym, as it
-    // iterates through the maps. When it's done, extra.the_vector
-    // will contain a vector of all the transaction numbers for offers that
-    // we should cancel, before placing the new offer. (Such as an offer to
-    // sell for 30 clams when our new offer buys for 40...)
-
-    the_lambda_struct extra;
-    extra.the_asset_acct = myacct;
-    extra.the_currency_acct = hisacct;
-    extra.the_scale = scale;
-    extra.the_price = price;
-    extra.bSelling = type == "ask";
-
-    if (0 > iterate_nymoffers_maps(*map_of_maps, find_strange_offers, extra)) {
+    // Okay -- if there are any offers we need to cancel, the index finds
+    // them with a lookup on the market's bid or ask side. Let's remove them
+    // from the market before starting up the new offer...
+    const auto crossing = index.Crossing(
+        myacct, hisacct, stoll(scale), type == "ask", stoll(price));
+
+    if (crossing.empty()) { return 0; }
+
+    for (const auto* offer : crossing) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot iterate nym's offers.")
+            ": Canceling market offer with transaction number: ")(
+            offer->number)
             .Flush();
-        return -1;
     }
 
-    // Okay -- if there are any offers we need to cancel, extra.the_vector
-    // now contains the transaction number for each one. Let's remove them from
-    // the market before starting up the new offer...
-    for (size_t i = 0; i < extra.the_vector.size(); i++) {
-        const string& id = extra.the_vector[i];
+    if (0 < killMarketOffers(server, mynym, crossing, DEFAULT_IN_FLIGHT)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Canceling market offer with transaction number: ")(id)
+            ": Error: cannot cancel crossing market offers.")
             .Flush();
-
-        int64_t j;
-        sscanf(id.c_str(), "%" SCNd64, &j);
-        std::string response;
-        {
-            response = Opentxs::Client()
-
-                           .ServerAction()
-                           .KillMarketOffer(
-                               Identifier::Factory(mynym),
-                               Identifier::Factory(server),
-                               Identifier::Factory(myacct),
-                               j)
-                           ->Run();
-        }
-        if (0 > processTxResponse(
-                    server, mynym, myacct, response, "kill market offer")) {
-            return -1;
-        }
+        return -1;
     }
-    extra.the_vector.clear();
 
     return 1;
 }
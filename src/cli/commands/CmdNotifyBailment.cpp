@@ -64,16 +64,18 @@ std::int32_t CmdNotifyBailment::run(
 
     if (0 == txid.size()) { return -1; }
 
-    auto task = Opentxs::Client().OTX().NotifyBailment(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        identifier::UnitDefinition::Factory(mypurse),
-        Identifier::Factory(request),
-        txid,
-        notifybailmentAmount);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().NotifyBailment(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            identifier::UnitDefinition::Factory(mypurse),
+            Identifier::Factory(request),
+            txid,
+            notifybailmentAmount);
+    });
     
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to notify bailment")
@@ -48,7 +48,8 @@ int32_t CmdOutbox::run(string myacct)
         return -1;
     }
 
-    string outbox = SwigWrap::LoadOutbox(server, mynym, myacct);
+    const string outbox = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadOutbox(server, mynym, myacct); });
     if ("" == outbox) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load outbox.")
             .Flush();
@@ -68,6 +69,8 @@ int32_t CmdOutbox::run(string myacct)
         return 0;
     }
 
+    cli::Stats::Scope scope("render");
+
     cout << "Show outbox for an asset account  (" << myacct << "): \n"
          << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
          << "---------------------------------|(from or to)\n";
@@ -19,19 +19,40 @@ using namespace std;
 CmdPasswordDecrypt::CmdPasswordDecrypt()
 {
     command = "passworddecrypt";
+    args[0] = "[--in <file>]";
+    args[1] = "[--out <file>]";
+    args[2] = "[--expect <file>]";
     category = catAdmin;
     help = "Password-decrypt a ciphertext using a symmetric key.";
+    usage = "With --in and --out, the file is decrypted a chunk at a time, so\n"
+            "it can be of any size. It can hold the output of --out or\n"
+            "of the interactive command. --expect fails the command unless\n"
+            "the decrypted file is identical to the given one.";
 }
 
 CmdPasswordDecrypt::~CmdPasswordDecrypt() {}
 
-int32_t CmdPasswordDecrypt::runWithOptions() { return run(); }
+int32_t CmdPasswordDecrypt::runWithOptions()
+{
+    return run(getOption("in"), getOption("out"), getOption("expect"));
+}
 
-int32_t CmdPasswordDecrypt::run()
+int32_t CmdPasswordDecrypt::run(string in, string out, string expect)
 {
     string key = inputText("a symmetric key");
     if ("" == key) { return -1; }
 
+    if ("" != in || "" != out || "" != expect) {
+        return convertFile(
+            in,
+            out,
+            false,
+            [&](const string& chunk) {
+                return SwigWrap::SymmetricDecrypt(key, chunk);
+            },
+            expect);
+    }
+
     string input = inputText("the encrypted text");
     if ("" == input) { return -1; }
 
@@ -19,19 +19,33 @@ using namespace std;
 CmdPasswordEncrypt::CmdPasswordEncrypt()
 {
     command = "passwordencrypt";
+    args[0] = "[--in <file>]";
+    args[1] = "[--out <file>]";
     category = catAdmin;
     help = "Password-encrypt a plaintext using a symmetric key.";
+    usage = "With --in and --out, the file is encrypted a chunk at a time, so\n"
+            "it can be of any size. It must hold text: a file with a NUL\n"
+            "byte is rejected. Read the result back with --in.";
 }
 
 CmdPasswordEncrypt::~CmdPasswordEncrypt() {}
 
-int32_t CmdPasswordEncrypt::runWithOptions() { return run(); }
+int32_t CmdPasswordEncrypt::runWithOptions()
+{
+    return run(getOption("in"), getOption("out"));
+}
 
-int32_t CmdPasswordEncrypt::run()
+int32_t CmdPasswordEncrypt::run(string in, string out)
 {
     string key = inputText("a symmetric key");
     if ("" == key) { return -1; }
 
+    if ("" != in || "" != out) {
+        return convertFile(in, out, true, [&](const string& chunk) {
+            return SwigWrap::SymmetricEncrypt(key, chunk);
+        });
+    }
+
     string input = inputText("the plaintext");
     if ("" == input) { return -1; }
 
@@ -17,7 +17,7 @@ public:
     EXPORT CmdPasswordEncrypt();
     virtual ~CmdPasswordEncrypt();
 
-    EXPORT int32_t run();
+    EXPORT int32_t run(std::string in, std::string out);
 
 protected:
     virtual int32_t runWithOptions();
@@ -90,12 +90,14 @@ int32_t CmdPayDividend::run(
     if (1 == reply) { return reply; }
 
     {
-        auto task = Opentxs::Client().OTX().ProcessInbox(
-            Identifier::Factory(mynym),
-            Identifier::Factory(server),
-            Identifier::Factory(myacct));
-
-        const auto result = std::get<1>(task).get();
+        auto task = cli::Stats::Submit([&]() {
+            return Opentxs::Client().OTX().ProcessInbox(
+                Identifier::Factory(mynym),
+                Identifier::Factory(server),
+                Identifier::Factory(myacct));
+        });
+
+        const auto result = cli::Stats::Wait(std::get<1>(task));
         
         const auto success = CmdBase::GetResultSuccess(result);
         if (false == success) {
@@ -46,15 +46,17 @@ std::int32_t CmdPeerStoreSecret::run(
 
     const std::string secondary = inputText("Passphrase");
 
-    auto task = Opentxs::Client().OTX().InitiateStoreSecret(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        proto::SecretType(1),
-        primary,
-        secondary);
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().InitiateStoreSecret(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            proto::SecretType(1),
+            primary,
+            secondary);
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to register contract")
@@ -0,0 +1,93 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdPreload.hpp"
+
+#include "Preloader.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#define OT_METHOD "opentxs::CmdPreload::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdPreload::CmdPreload()
+{
+    command = "preload";
+    args[0] = "[--cancel <true|false>]";
+    args[1] = "[--threads <count> (default 2)]";
+    args[2] = "[--pause <ms between jobs> (default 10)]";
+    args[3] = "[--items <messages per thread> (default 10)]";
+    category = catOtherUsers;
+    help = "Show, start or cancel the background cache preload.";
+    usage = "An interactive session starts a preload of activity, threads,\n"
+            "contact lists and account boxes on its own (unless started\n"
+            "with --nopreload). Without options, shows its progress and\n"
+            "starts a new one if none is running.";
+}
+
+CmdPreload::~CmdPreload() {}
+
+int32_t CmdPreload::runWithOptions()
+{
+    return run(
+        getOption("cancel"),
+        getOption("threads"),
+        getOption("pause"),
+        getOption("items"));
+}
+
+int32_t CmdPreload::run(
+    string cancel,
+    string threads,
+    string pause,
+    string items)
+{
+    if ("" != cancel && !checkFlag("cancel", cancel)) { return -1; }
+
+    if ("" != threads && !checkValue("threads", threads)) { return -1; }
+
+    if ("" != pause && !checkValue("pause", pause)) { return -1; }
+
+    if ("" != items && !checkValue("items", items)) { return -1; }
+
+    auto& preload = Opentxs::Preload();
+
+    if ("true" == cancel) {
+        preload.Cancel();
+    } else {
+        cli::Preloader::Settings settings{};
+
+        if ("" != threads) { settings.threads_ = stoul(threads); }
+
+        if ("" != pause) {
+            settings.pause_ = chrono::milliseconds(stoul(pause));
+        }
+
+        if ("" != items) { settings.items_ = stoul(items); }
+
+        if (preload.Start(settings)) {
+            cout << "Preload started.\n";
+        } else if ("" != threads || "" != pause || "" != items) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": A preload is already running; cancel it first to change "
+                "its settings.")
+                .Flush();
+        }
+    }
+
+    const auto status = preload.Progress();
+    cout << "Preload " << (status.running_ ? "running" : "idle")
+         << (status.cancelled_ ? " (cancelled)" : "") << ": " << status.done_
+         << " jobs done, " << status.pending_ << " pending.\n";
+
+    return 1;
+}
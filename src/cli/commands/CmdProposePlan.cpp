@@ -143,10 +143,12 @@ int32_t CmdProposePlan::run(
 
     std::shared_ptr<const OTPayment> ppayment{payment.release()};
 
-    auto task = Opentxs::Client().OTX().PayContact(
-        Identifier::Factory(mynym), contactid, ppayment);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PayContact(
+            Identifier::Factory(mynym), contactid, ppayment);
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
@@ -52,12 +52,14 @@ int32_t CmdRefresh::run(string myacct)
     CmdRefreshNym refreshNym;
     if (0 > refreshNym.run(server, mynym)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().ProcessInbox(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(myacct));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().ProcessInbox(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(myacct));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
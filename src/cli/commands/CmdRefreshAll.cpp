@@ -7,22 +7,192 @@
 
 #include <opentxs/opentxs.hpp>
 
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdRefreshAll::"
+
 namespace opentxs
 {
+namespace
+{
+struct NotarySummary {
+    std::map<std::string, std::vector<std::string>> nyms_;
+    std::size_t accounts_{0};
+    std::atomic<std::size_t> failed_{0};
+    std::chrono::milliseconds elapsed_{0};
+};
+}  // namespace
 
 CmdRefreshAll::CmdRefreshAll()
 {
     command = "refreshall";
+    args[0] = "[--inflight <requests per server> (default 8)]";
+    args[1] = "[--background <true|false>]";
     category = catWallet;
     help = "Refresh all nyms in the wallet on all servers.";
+    usage = "Waits until every nym and account has been refreshed and\n"
+            "reports the time taken for each server. Specify\n"
+            "--background true to only trigger a refresh and return.";
 }
 
-int32_t CmdRefreshAll::runWithOptions() { return run(); }
+int32_t CmdRefreshAll::runWithOptions()
+{
+    return run(getOption("inflight"), getOption("background"));
+}
+
+bool CmdRefreshAll::refresh_nym(
+    const std::string& server,
+    const std::string& mynym,
+    const std::vector<std::string>& accounts,
+    std::atomic<std::size_t>& failed) const
+{
+    const auto nymID = Identifier::Factory(mynym);
+    const auto serverID = Identifier::Factory(server);
+    auto nymbox = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().DownloadNymbox(nymID, serverID);
+    });
+
+    const auto& result = cli::Stats::Wait(std::get<1>(nymbox));
+
+    if (false == CmdBase::GetResultSuccess(result)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Failed to refresh nym ")(mynym)(
+            " on server ")(server)
+            .Flush();
+        ++failed;
 
-int32_t CmdRefreshAll::run()
+        return false;
+    }
+
+    bool output{true};
+
+    for (const auto& myacct : accounts) {
+        auto inbox = cli::Stats::Submit([&]() {
+            return Opentxs::Client().OTX().ProcessInbox(
+                nymID, serverID, Identifier::Factory(myacct));
+        });
+
+        const auto& processed = cli::Stats::Wait(std::get<1>(inbox));
+
+        if (false == CmdBase::GetResultSuccess(processed)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error retrieving intermediary files for account ")(myacct)
+                .Flush();
+            ++failed;
+            output = false;
+        }
+    }
+
+    return output;
+}
+
+int32_t CmdRefreshAll::run(std::string inflight, std::string background)
 {
-    SwigWrap::Trigger_Refresh();
+    if ("" != background && !checkFlag("background", background)) {
+        return -1;
+    }
+
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    if ("true" == background) {
+        SwigWrap::Trigger_Refresh();
+
+        return 1;
+    }
+
+    const std::size_t depth =
+        "" == inflight ? DEFAULT_IN_FLIGHT : std::stoul(inflight);
+    std::map<std::string, NotarySummary> notaries;
+    const auto nymCount = SwigWrap::GetNymCount();
+    const auto serverCount = SwigWrap::GetServerCount();
+
+    for (std::int32_t i = 0; i < serverCount; ++i) {
+        const auto server = SwigWrap::GetServer_ID(i);
+
+        for (std::int32_t j = 0; j < nymCount; ++j) {
+            const auto mynym = SwigWrap::GetNym_ID(j);
+
+            if (SwigWrap::IsNym_RegisteredAtServer(mynym, server)) {
+                notaries[server].nyms_[mynym];
+            }
+        }
+    }
+
+    for (const auto& it : Opentxs::Client().Storage().AccountList()) {
+        const auto& myacct = std::get<0>(it);
+        const auto server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+        const auto mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+
+        if ("" == server || "" == mynym) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: cannot determine server and nym for account ")(
+                myacct)
+                .Flush();
+            continue;
+        }
+
+        auto& notary = notaries[server];
+        notary.nyms_[mynym].push_back(myacct);
+        ++notary.accounts_;
+    }
+
+    if (notaries.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Nothing to refresh.").Flush();
+
+        return 0;
+    }
+
+    // Every server gets its own pipeline, so a slow server only limits how
+    // quickly its own nyms are refreshed.
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+
+    for (auto& it : notaries) {
+        const auto& server = it.first;
+        auto& notary = it.second;
+        threads.emplace_back([this, &server, &notary, depth]() {
+            const auto begin = std::chrono::steady_clock::now();
+            cli::Pipeline pipeline(depth);
+
+            for (const auto& nym : notary.nyms_) {
+                const auto& mynym = nym.first;
+                const auto& accounts = nym.second;
+                pipeline.Add([this, &server, &mynym, &accounts, &notary]() {
+                    return refresh_nym(
+                        server, mynym, accounts, notary.failed_);
+                });
+            }
+
+            pipeline.Run();
+            notary.elapsed_ =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - begin);
+        });
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::size_t failed{0};
+
+    for (const auto& it : notaries) {
+        const auto& server = it.first;
+        const auto& notary = it.second;
+        failed += notary.failed_;
+        std::cout << server << " (" << SwigWrap::GetServer_Name(server)
+                  << "): " << notary.nyms_.size() << " nyms, "
+                  << notary.accounts_ << " accounts, " << notary.failed_
+                  << " failed, " << notary.elapsed_.count() << " ms\n";
+    }
+
+    std::cout << "Refreshed " << notaries.size() << " servers in "
+              << elapsed.count() << " ms, " << failed << " failed.\n";
 
-    return 1;
+    return 0 == failed ? 1 : -1;
 }
 }  // namespace opentxs
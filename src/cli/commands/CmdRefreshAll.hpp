@@ -8,6 +8,10 @@
 
 #include "CmdBase.hpp"
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 namespace opentxs
 {
 
@@ -17,10 +21,19 @@ public:
     EXPORT CmdRefreshAll();
     EXPORT ~CmdRefreshAll() = default;
 
-    EXPORT int32_t run();
+    EXPORT int32_t run(std::string inflight, std::string background);
 
 protected:
     virtual int32_t runWithOptions();
+
+private:
+    // Downloads the nymbox, then processes the inbox of each account the
+    // nym has on that server. Returns false if any step failed.
+    bool refresh_nym(
+        const std::string& server,
+        const std::string& mynym,
+        const std::vector<std::string>& accounts,
+        std::atomic<std::size_t>& failed) const;
 };
 } // namespace opentxs
 
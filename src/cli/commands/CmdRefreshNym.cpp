@@ -38,10 +38,12 @@ int32_t CmdRefreshNym::run(string server, string mynym)
 
     if (!checkNym("mynym", mynym)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().DownloadNymbox(
-        Identifier::Factory(mynym), Identifier::Factory(server));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().DownloadNymbox(
+            Identifier::Factory(mynym), Identifier::Factory(server));
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
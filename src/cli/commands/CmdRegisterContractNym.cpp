@@ -40,12 +40,14 @@ int32_t CmdRegisterContractNym::run(string server, string mynym, string hisnym)
 
     if (!checkNym("hisnym", hisnym, true)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().PublishServerContract(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PublishServerContract(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to register contract")
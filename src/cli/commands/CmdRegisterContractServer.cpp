@@ -42,12 +42,14 @@ int32_t CmdRegisterContractServer::run(
 
     if (!checkNym("mynym", mynym)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().PublishServerContract(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(contract));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PublishServerContract(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(contract));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
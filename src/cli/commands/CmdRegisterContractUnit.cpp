@@ -41,12 +41,14 @@ int32_t CmdRegisterContractUnit::run(
 
     if (!checkNym("mynym", mynym)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().PublishServerContract(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(hispurse));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().PublishServerContract(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(hispurse));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -73,7 +73,7 @@ std::int32_t CmdRegisterNym::run(
         shouldPublish,
         isPrimary);
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
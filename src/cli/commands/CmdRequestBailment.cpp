@@ -48,13 +48,15 @@ std::int32_t CmdRequestBailment::run(
 
     if (!checkPurse("mypurse", mypurse)) { return -1; }
 
-    auto task = Opentxs::Client().OTX().InitiateBailment(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        identifier::UnitDefinition::Factory(mypurse));
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().InitiateBailment(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            identifier::UnitDefinition::Factory(mypurse));
+    });
     
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to request bailment")
@@ -60,13 +60,15 @@ std::int32_t CmdRequestConnection::run(
         return -1;
     }
 
-    auto task = Opentxs::Client().OTX().InitiateRequestConnection(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        proto::ConnectionInfoType(type));
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().InitiateRequestConnection(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            proto::ConnectionInfoType(type));
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to request connection")
@@ -57,15 +57,17 @@ std::int32_t CmdRequestOutBailment::run(
     std::int64_t outbailmentAmount = SwigWrap::StringToAmount(mypurse, amount);
     if (OT_ERROR_AMOUNT == outbailmentAmount) { return -1; }
 
-    auto task = Opentxs::Client().OTX().InitiateOutbailment(
-        identifier::Nym::Factory(mynym),
-        identifier::Server::Factory(server),
-        identifier::Nym::Factory(hisnym),
-        identifier::UnitDefinition::Factory(mypurse),
-        outbailmentAmount,
-        terms);
-
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().InitiateOutbailment(
+            identifier::Nym::Factory(mynym),
+            identifier::Server::Factory(server),
+            identifier::Nym::Factory(hisnym),
+            identifier::UnitDefinition::Factory(mypurse),
+            outbailmentAmount,
+            terms);
+    });
+
+    const auto result = cli::Stats::Wait(std::get<1>(task));
 
     if (false == CmdBase::GetResultSuccess(result)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to request outbailment")
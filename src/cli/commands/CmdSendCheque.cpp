@@ -5,10 +5,14 @@
 
 #include "CmdSendCheque.hpp"
 
+#include <opentxs/opentxs.hpp>
+
 #include <stdint.h>
 #include <iostream>
 #include <string>
 
+#define OT_METHOD "opentxs::CmdSendCheque::"
+
 using namespace opentxs;
 using namespace std;
 
@@ -17,12 +21,19 @@ CmdSendCheque::CmdSendCheque()
     command = "sendcheque";
     args[0] = "--myacct <account>";
     args[1] = "[--hisnym <nym>]";
-    args[2] = "--amount <amount>";
+    args[2] = "[--amount <amount>]";
     args[3] = "[--memo <memoline>]";
     args[4] = "[--validfor <seconds>]";
+    args[5] = "[--file <csvfile>]";
+    args[6] = "[--results <csvfile>]";
+    args[7] = "[--inflight <requests> (default 8)]";
     category = catOtherUsers;
     help = "Write a cheque and then send it to the recipient.";
-    usage = "Use writecheque if you don't want to send it immediately.";
+    usage = "Use writecheque if you don't want to send it immediately.\n"
+            "Use --file instead of --hisnym and --amount to send one cheque\n"
+            "per line of a CSV file (hisnym,amount[,memo]). The cheques are\n"
+            "signed on all cores and up to --inflight of them are sent at\n"
+            "once. Per-line results go to --results (default <file>.results).";
 }
 
 CmdSendCheque::~CmdSendCheque() {}
@@ -34,7 +45,10 @@ int32_t CmdSendCheque::runWithOptions()
         getOption("hisnym"),
         getOption("amount"),
         getOption("memo"),
-        getOption("validfor"));
+        getOption("validfor"),
+        getOption("file"),
+        getOption("results"),
+        getOption("inflight"));
 }
 
 int32_t CmdSendCheque::run(
@@ -42,8 +56,24 @@ int32_t CmdSendCheque::run(
     string hisnym,
     string amount,
     string memo,
-    string validfor)
+    string validfor,
+    string file,
+    string results,
+    string inflight)
 {
+    if ("" != file && ("" != hisnym || "" != amount || "" != memo)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: specify either --file or --hisnym/--amount/--memo, "
+            "not both.")
+            .Flush();
+
+        return -1;
+    }
+
+    if ("" != file) {
+        return sendBatch(myacct, file, results, validfor, inflight, false);
+    }
+
     string cheque = writeCheque(myacct, hisnym, amount, memo, validfor, false);
     if ("" == cheque) { return -1; }
 
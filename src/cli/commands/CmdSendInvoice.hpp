@@ -19,7 +19,8 @@ public:
 
     EXPORT int32_t run(std::string myacct, std::string hisnym,
                        std::string amount, std::string memo,
-                       std::string validfor);
+                       std::string validfor, std::string file,
+                       std::string results, std::string inflight);
 
 protected:
     virtual int32_t runWithOptions();
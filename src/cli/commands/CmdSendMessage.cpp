@@ -63,10 +63,12 @@ std::int32_t CmdSendMessage::nym(
     const auto contactid =
         Opentxs::Client().Contacts().ContactID(Identifier::Factory(hisnym));
 
-    auto task = Opentxs::Client().OTX().MessageContact(
-        Identifier::Factory(mynym), contactid, message);
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().MessageContact(
+            Identifier::Factory(mynym), contactid, message);
+    });
 
-    const auto result = std::get<1>(task).get();
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     
     const auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
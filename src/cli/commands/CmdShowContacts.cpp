@@ -16,21 +16,28 @@ CmdShowContacts::CmdShowContacts()
 {
     command = "showcontacts";
     args[0] = "--mynym <nym>";
+    args[1] = "[--timeout <ms> (default 5000)]";
     category = catOtherUsers;
     help = "Show the contact list for a nym in the wallet.";
 }
 
 std::int32_t CmdShowContacts::runWithOptions()
 {
-    return run(getOption("mynym"));
+    return run(getOption("mynym"), getOption("timeout"));
 }
 
-std::int32_t CmdShowContacts::run(std::string mynym)
+std::int32_t CmdShowContacts::run(
+    std::string mynym,
+    const std::string& timeout)
 {
     if (!checkNym("mynym", mynym)) { return -1; }
 
+    if ("" != timeout && !checkValue("timeout", timeout)) { return -1; }
+
     const OTIdentifier nymID = Identifier::Factory({mynym});
     auto& list = Opentxs::Client().UI().ContactList(nymID);
+    awaitModel(
+        list.WidgetID(), [&]() { return list.First()->Valid(); }, timeout);
     LogNormal(OT_METHOD)(__FUNCTION__)(": Contacts:").Flush();
     dashLine();
     auto line = list.First();
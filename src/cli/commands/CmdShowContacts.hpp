@@ -18,7 +18,9 @@ class CmdShowContacts : public CmdBase
 public:
     EXPORT CmdShowContacts();
 
-    EXPORT std::int32_t run(std::string mynym);
+    EXPORT std::int32_t run(
+        std::string mynym,
+        const std::string& timeout);
 
     EXPORT ~CmdShowContacts() = default;
 
@@ -46,7 +46,8 @@ int32_t CmdShowExpired::run(string server, string mynym)
 
     if (!checkNym("mynym", mynym)) { return -1; }
 
-    string expired = SwigWrap::LoadExpiredBox(server, mynym);
+    const string expired = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadExpiredBox(server, mynym); });
     if ("" == expired) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load expired record box.")
@@ -68,6 +69,8 @@ int32_t CmdShowExpired::run(string server, string mynym)
         return 0;
     }
 
+    cli::Stats::Scope scope("render");
+
     cout << "Expired records:\n";
     cout << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
     cout << "---------------------------------|(from or to)\n";
@@ -5,10 +5,13 @@
 
 #include "CmdShowMarkets.hpp"
 
+#include "MarketIndex.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #define OT_METHOD "opentxs::CmdShowMarkets"
@@ -20,107 +23,69 @@ CmdShowMarkets::CmdShowMarkets()
 {
     command = "showmarkets";
     args[0] = "--server <server>";
+    args[1] = "[--unit <unit>]";
     category = catMarkets;
     help = "Show the list of markets.";
+    usage = "Specify --unit to list only markets trading that asset or "
+            "currency.";
 }
 
 CmdShowMarkets::~CmdShowMarkets() {}
 
-int32_t CmdShowMarkets::runWithOptions() { return run(getOption("server")); }
+int32_t CmdShowMarkets::runWithOptions()
+{
+    return run(getOption("server"), getOption("unit"));
+}
 
-int32_t CmdShowMarkets::run(string server)
+int32_t CmdShowMarkets::run(string server, string unit)
 {
     if (!checkServer("server", server)) { return -1; }
 
-    OTDB::MarketList* marketList = loadMarketList(server);
-    if (nullptr == marketList) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load market list.")
-            .Flush();
-        return -1;
-    }
+    if ("" != unit && !checkPurse("unit", unit)) { return -1; }
 
-    int32_t items = marketList->GetMarketDataCount();
-    if (0 > items) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Error: cannot load market list item count.")
-            .Flush();
-        return -1;
-    }
-
-    if (0 == items) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(": The market list is empty.")
-            .Flush();
-        return 0;
-    }
+    std::unique_ptr<cli::MarketIndex> index{new cli::MarketIndex(server)};
 
-    cout << "Index\tScale\tMarket\t\t\t\t\t\tAsset\t\t\t\t\t\tCurrency\n";
-
-    for (int32_t i = 0; i < items; i++) {
-        OTDB::MarketData* marketData = marketList->GetMarketData(i);
-        if (nullptr == marketData) {
+    if (!index->IsValid()) {
+        // Market lists downloaded before the index existed, an index that
+        // failed to write, or a market_data.bin changed since it was built.
+        // Build it from market_data.bin again.
+        if (!cli::MarketIndex::Rebuild(server)) {
             LogNormal(OT_METHOD)(__FUNCTION__)(
-                ": Error: cannot load market data at index ")(i)
+                ": Error: cannot load market list.")
                 .Flush();
             return -1;
         }
 
-        cout << i << "\t" << marketData->scale << "\tM "
-             << marketData->market_id << "\tA "
-             << marketData->instrument_definition_id << "\tC "
-             << marketData->currency_type_id << "\n";
+        index.reset(new cli::MarketIndex(server));
     }
 
-    return 1;
-}
-
-OTDB::MarketList* CmdShowMarkets::loadMarketList(const string& server)
-{
-    if (!OTDB::Exists(
-            Opentxs::Client().DataFolder(),
-            "markets",
-            server,
-            "market_data.bin",
-            "")) {
+    if (!index->IsValid()) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": The market list file doesn't exist")
+            ": Error: cannot load market list index.")
             .Flush();
-        return nullptr;
+        return -1;
     }
 
-    LogDetail(OT_METHOD)(__FUNCTION__)(
-        ": Markets file exists... Querying list of markets...")
-        .Flush();
-
-    OTDB::Storable* storable = OTDB::QueryObject(
-        OTDB::STORED_OBJ_MARKET_LIST,
-        Opentxs::Client().DataFolder(),
-        "markets",
-        server,
-        "market_data.bin",
-        "");
-    if (nullptr == storable) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Failed to verify storable object. "
-            "Probably doesn't exist.")
+    if (0 == index->size()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The market list is empty.")
             .Flush();
-        return nullptr;
+        return 0;
     }
 
-    LogDetail(OT_METHOD)(__FUNCTION__)(
-        "QueryObject worked. Now dynamic casting from storable to "
-        "marketlist...")
-        .Flush();
+    cout << "Index\tScale\tMarket\t\t\t\t\t\tAsset\t\t\t\t\t\tCurrency"
+            "\t\t\t\t\t\tLast\tVolume\n";
 
-    OTDB::MarketList* marketList = dynamic_cast<OTDB::MarketList*>(storable);
-    if (nullptr == marketList) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Unable to dynamic cast a storable to a marketlist.")
-            .Flush();
-        return nullptr;
-    }
+    for (std::size_t i = 0; i < index->size(); i++) {
+        if (!index->Matches(i, unit)) { continue; }
 
-    return marketList;
+        const auto& marketData = index->at(i);
+        cout << i << "\t" << marketData.scale << "\tM "
+             << marketData.market_id << "\tA "
+             << marketData.instrument_definition_id << "\tC "
+             << marketData.currency_type_id << "\t"
+             << marketData.last_sale_price << "\t"
+             << marketData.volume_assets << "\n";
+    }
 
-    // This WAS a "load or create" sort of function, but I commented out the
-    // "create" part because you will literally NEVER need to create this list.
+    return 1;
 }
@@ -11,24 +11,16 @@
 namespace opentxs
 {
 
-namespace OTDB
-{
-class MarketList;
-}
-
 class CmdShowMarkets : public CmdBase
 {
 public:
     EXPORT CmdShowMarkets();
     virtual ~CmdShowMarkets();
 
-    EXPORT int32_t run(std::string server);
+    EXPORT int32_t run(std::string server, std::string unit);
 
 protected:
     virtual int32_t runWithOptions();
-
-private:
-    OTDB::MarketList* loadMarketList(const std::string& server);
 };
 
 } // namespace opentxs
@@ -18,7 +18,9 @@ class CmdShowMessagable : public CmdBase
 public:
     EXPORT CmdShowMessagable();
 
-    EXPORT std::int32_t run(std::string mynym);
+    EXPORT std::int32_t run(
+        std::string mynym,
+        const std::string& timeout);
 
     EXPORT ~CmdShowMessagable() = default;
 
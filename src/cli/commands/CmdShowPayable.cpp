@@ -17,25 +17,34 @@ CmdShowPayable::CmdShowPayable()
     command = "showpayable";
     args[0] = "--mynym <nym>";
     args[1] = "--currency <id>";
+    args[2] = "[--timeout <ms> (default 5000)]";
     category = catOtherUsers;
     help = "Show the list of payable contacts for a currency.";
 }
 
 std::int32_t CmdShowPayable::runWithOptions()
 {
-    return run(getOption("mynym"), getOption("currency"));
+    return run(
+        getOption("mynym"), getOption("currency"), getOption("timeout"));
 }
 
-std::int32_t CmdShowPayable::run(std::string mynym, std::string currency)
+std::int32_t CmdShowPayable::run(
+    std::string mynym,
+    std::string currency,
+    const std::string& timeout)
 {
     if (!checkNym("mynym", mynym)) { return -1; }
 
     if (!checkMandatory("currency", currency)) { return -1; }
 
+    if ("" != timeout && !checkValue("timeout", timeout)) { return -1; }
+
     auto currencyType = proto::ContactItemType(std::stoi(currency));
 
     const OTIdentifier nymID = Identifier::Factory({mynym});
     auto& list = Opentxs::Client().UI().PayableList(nymID, currencyType);
+    awaitModel(
+        list.WidgetID(), [&]() { return list.First()->Valid(); }, timeout);
     LogNormal(OT_METHOD)(__FUNCTION__)(": Contacts:").Flush();
     dashLine();
     auto line = list.First();
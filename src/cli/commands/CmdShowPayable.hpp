@@ -18,7 +18,10 @@ class CmdShowPayable : public CmdBase
 public:
     EXPORT CmdShowPayable();
 
-    EXPORT std::int32_t run(std::string mynym, std::string currency);
+    EXPORT std::int32_t run(
+        std::string mynym,
+        std::string currency,
+        const std::string& timeout);
 
     EXPORT ~CmdShowPayable() = default;
 
@@ -52,7 +52,8 @@ int32_t CmdShowPayment::run(
 
     if ("" != showmemo && !checkFlag("showmemo", showmemo)) { return -1; }
 
-    string inbox = SwigWrap::LoadPaymentInbox(server, mynym);
+    const string inbox = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadPaymentInbox(server, mynym); });
     if ("" == inbox) {
         LogNormal(OT_METHOD)(__FUNCTION__)(
             ": Error: cannot load payment inbox.")
@@ -92,7 +92,8 @@ int32_t CmdShowRecords::showRecords(
     const string& mynym,
     const string& myacct)
 {
-    string records = SwigWrap::LoadRecordBox(server, mynym, myacct);
+    const string records = cli::Stats::Ledger(
+        [&]() { return SwigWrap::LoadRecordBox(server, mynym, myacct); });
     if ("" == records) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot load record box.")
             .Flush();
@@ -113,6 +114,8 @@ int32_t CmdShowRecords::showRecords(
         return 0;
     }
 
+    cli::Stats::Scope scope("render");
+
     cout << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
     cout << "---------------------------------|(from or to)\n";
     for (int32_t i = 0; i < items; i++) {
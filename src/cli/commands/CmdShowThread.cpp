@@ -5,9 +5,14 @@
 
 #include "CmdShowThread.hpp"
 
+#include "TimeFormatter.hpp"
+
 #include <opentxs/opentxs.hpp>
 
-#include <ctime>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
 
 #define OT_METHOD "opentxs::CmdShowThread::"
 
@@ -18,51 +23,136 @@ CmdShowThread::CmdShowThread()
     command = "showthread";
     args[0] = "--mynym <nym>";
     args[1] = "--thread <threadID>";
+    args[2] = "[--timeout <ms> (default 5000)]";
+    args[3] = "[--limit <count>]";
+    args[4] = "[--tail <count>]";
+    args[5] = "[--before <unix time in ms>]";
     category = catOtherUsers;
     help = "Display the contents of an activity thread.";
+    usage = "Items are shown oldest first. Specify --limit to show only the\n"
+            "oldest items, or --tail to show only the newest ones. Specify\n"
+            "--before to skip items at or after that time, in milliseconds\n"
+            "since the epoch. To page back through a long thread, pass the\n"
+            "time of the oldest item shown by the previous --tail.";
 }
 
 std::int32_t CmdShowThread::runWithOptions()
 {
-    return run(getOption("mynym"), getOption("thread"));
+    return run(
+        getOption("mynym"),
+        getOption("thread"),
+        getOption("timeout"),
+        getOption("limit"),
+        getOption("tail"),
+        getOption("before"));
 }
 
-std::int32_t CmdShowThread::run(std::string mynym, const std::string& threadID)
+std::int32_t CmdShowThread::run(
+    std::string mynym,
+    const std::string& threadID,
+    const std::string& timeout,
+    const std::string& limit,
+    const std::string& tail,
+    const std::string& before)
 {
     if (!checkNym("mynym", mynym)) { return -1; }
 
+    if ("" != timeout && !checkValue("timeout", timeout)) { return -1; }
+
+    if ("" != limit && !checkValue("limit", limit)) { return -1; }
+
+    if ("" != tail && !checkValue("tail", tail)) { return -1; }
+
+    if ("" != before && !checkValue("before", before)) { return -1; }
+
+    if ("" != limit && "" != tail) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: specify either --limit or --tail, not both.")
+            .Flush();
+
+        return -1;
+    }
+
+    const bool keepNewest = "" != tail;
+    const std::size_t count = keepNewest
+                                  ? std::stoul(tail)
+                                  : ("" == limit ? 0 : std::stoul(limit));
+    const bool haveCutoff = "" != before;
+    const std::int64_t cutoff = haveCutoff ? std::stoll(before) : 0;
+    const auto ms = [](const std::chrono::system_clock::time_point& time) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   time.time_since_epoch())
+            .count();
+    };
+
+    const auto stored = Opentxs::Client().Activity().Thread(
+        Identifier::Factory(mynym), Identifier::Factory(threadID));
+    const bool empty = (false == bool(stored)) || (0 == stored->item_size());
     const auto& thread = Opentxs::Client().UI().ActivityThread(
         Identifier::Factory(mynym), Identifier::Factory(threadID));
-    const auto first = thread.First();
+    awaitModel(
+        thread.WidgetID(),
+        [&]() { return empty || thread.First()->Valid(); },
+        timeout);
+    auto line = thread.First();
     LogNormal(OT_METHOD)(__FUNCTION__)(thread.DisplayName()).Flush();
 
-    if (false == first->Valid()) { return 0; }
+    if (false == line->Valid()) { return 0; }
+
+    // The thread can only be walked oldest first, so for --tail the walk
+    // keeps a window of the newest rows and only those get formatted. Rows
+    // are in time order, which lets --before and --limit stop early. Items
+    // with the same time are dropped from the window together, so the
+    // --before hint for the next page can't skip any of them; the window
+    // grows past --tail when a group doesn't fit.
+    std::deque<decltype(thread.First())> items;
+    std::size_t skipped{0};
+
+    while (true) {
+        if (haveCutoff && ms(line->Timestamp()) >= cutoff) { break; }
+
+        items.push_back(line);
+
+        while (keepNewest && items.size() > count) {
+            const auto oldest = ms(items.front()->Timestamp());
+            std::size_t group{1};
 
-    auto last = first->Last();
-    LogNormal(OT_METHOD)(__FUNCTION__)(": * ")(time(first->Timestamp()))(
-        " (StorageBox: ")(storage_box_name(first->Type()))(")")
-        .Flush();
-    LogNormal(OT_METHOD)(__FUNCTION__)(first->Text()).Flush();
+            while (group < items.size() &&
+                   oldest == ms(items[group]->Timestamp())) {
+                ++group;
+            }
 
-    while (false == last) {
-        const auto line = thread.Next();
-        last = line->Last();
-        LogNormal(OT_METHOD)(__FUNCTION__)(": * ")(time(line->Timestamp()))(
-            " (StorageBox: ")(storage_box_name(line->Type()))(")")
+            if (items.size() - group < count) { break; }
+
+            items.erase(items.begin(), items.begin() + group);
+            skipped += group;
+        }
+
+        if (!keepNewest && 0 < count && items.size() == count) { break; }
+
+        if (line->Last()) { break; }
+
+        line = thread.Next();
+    }
+
+    cli::TimeFormatter time;
+
+    for (const auto& item : items) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": * ")(time(item->Timestamp()))(
+            " (StorageBox: ")(storage_box_name(item->Type()))(")")
+            .Flush();
+        LogNormal(OT_METHOD)(__FUNCTION__)(item->Text()).Flush();
+    }
+
+    if (0 < skipped && false == items.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": ")(skipped)(
+            " older items not shown; use --before ")(
+            ms(items.front()->Timestamp()))(" to see them.")
             .Flush();
-        LogNormal(OT_METHOD)(__FUNCTION__)(line->Text()).Flush();
     }
 
     LogNormal(OT_METHOD)(__FUNCTION__)(" ").Flush();
 
     return 0;
 }
-
-std::string CmdShowThread::time(
-    const std::chrono::system_clock::time_point in) const
-{
-    const auto converted = std::chrono::system_clock::to_time_t(in);
-
-    return std::ctime(&converted);
-}
 }  // namespace opentxs
@@ -8,7 +8,6 @@
 
 #include "CmdBase.hpp"
 
-#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -20,12 +19,13 @@ class CmdShowThread : public CmdBase
 public:
     CmdShowThread();
 
-    std::string time(
-        const std::chrono::system_clock::time_point in) const;
-
     std::int32_t run(
         std::string mynym,
-        const std::string& threadID);
+        const std::string& threadID,
+        const std::string& timeout,
+        const std::string& limit,
+        const std::string& tail,
+        const std::string& before);
 
     ~CmdShowThread() = default;
 
@@ -82,15 +82,17 @@ int32_t CmdTransfer::run(
             .Flush();
     }
 
-    auto task = Opentxs::Client().OTX().SendTransfer(
-        Identifier::Factory(mynym),
-        Identifier::Factory(server),
-        Identifier::Factory(myacct),
-        Identifier::Factory(hisacct),
-        value,
-        memo);
-
-    auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().SendTransfer(
+            Identifier::Factory(mynym),
+            Identifier::Factory(server),
+            Identifier::Factory(myacct),
+            Identifier::Factory(hisacct),
+            value,
+            memo);
+    });
+
+    auto result = cli::Stats::Wait(std::get<1>(task));
     
     auto success = CmdBase::GetResultSuccess(result);
     if (false == success) {
@@ -107,7 +109,7 @@ int32_t CmdTransfer::run(
         Identifier::Factory(server),
         Identifier::Factory(myacct));
 
-    result = std::get<1>(task).get();
+    result = cli::Stats::Wait(std::get<1>(task));
     success = CmdBase::GetResultSuccess(result);
 
     if (false == success) {
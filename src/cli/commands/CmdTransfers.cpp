@@ -0,0 +1,239 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdTransfers.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdTransfers::"
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Transfer {
+    std::size_t line_{0};
+    string server_;
+    string mynym_;
+    string myacct_;
+    string hisacct_;
+    string amount_;
+    int64_t value_{0};
+    string memo_;
+};
+}  // namespace
+
+CmdTransfers::CmdTransfers()
+{
+    command = "transfers";
+    args[0] = "--file <csvfile>";
+    args[1] = "[--results <csvfile> (default <file>.results)]";
+    args[2] = "[--inflight <requests> (default 8)]";
+    category = catAccounts;
+    help = "Send the transfers listed in a file.";
+    usage = "Each line of the file holds: myacct,hisacct,amount[,memo]\n"
+            "Every line is validated before anything is sent. One result\n"
+            "line per transfer is written to the results file.";
+}
+
+CmdTransfers::~CmdTransfers() {}
+
+int32_t CmdTransfers::runWithOptions()
+{
+    return run(getOption("file"), getOption("results"), getOption("inflight"));
+}
+
+int32_t CmdTransfers::run(string file, string results, string inflight)
+{
+    if ("" != inflight && !checkValue("inflight", inflight)) { return -1; }
+
+    CsvRows rows;
+
+    if (!loadCsv("file", file, 4, rows)) { return -1; }
+
+    if (rows.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The file is empty.").Flush();
+        return 0;
+    }
+
+    vector<Transfer> transfers;
+    // (server, nym) -> transfers needing a transaction number
+    map<pair<string, string>, std::size_t> numbers;
+    std::size_t invalid{0};
+
+    for (const auto& row : rows) {
+        const auto& fields = row.second;
+        Transfer transfer;
+        transfer.line_ = row.first;
+
+        if (3 > fields.size()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": expected myacct,hisacct,amount[,memo].")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        transfer.myacct_ = fields[0];
+        transfer.hisacct_ = fields[1];
+        transfer.amount_ = fields[2];
+
+        if (3 < fields.size()) { transfer.memo_ = fields[3]; }
+
+        if (!checkAccount("myacct", transfer.myacct_) ||
+            !checkAccount("hisacct", transfer.hisacct_)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": invalid account.")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        transfer.value_ =
+            checkAmount("amount", transfer.amount_, transfer.myacct_);
+
+        if (OT_ERROR_AMOUNT == transfer.value_) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": invalid amount.")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        transfer.server_ =
+            SwigWrap::GetAccountWallet_NotaryID(transfer.myacct_);
+        transfer.mynym_ = SwigWrap::GetAccountWallet_NymID(transfer.myacct_);
+
+        if ("" == transfer.server_ || "" == transfer.mynym_) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": cannot determine server and nym from myacct.")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        if (SwigWrap::GetAccountWallet_NotaryID(transfer.hisacct_) !=
+            transfer.server_) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(row.first)(
+                ": myacct and hisacct are on different servers.")
+                .Flush();
+            ++invalid;
+            continue;
+        }
+
+        ++numbers[{transfer.server_, transfer.mynym_}];
+        transfers.push_back(std::move(transfer));
+    }
+
+    if (0 < invalid) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: ")(invalid)(
+            " invalid lines. Nothing was sent.")
+            .Flush();
+        return -1;
+    }
+
+    for (const auto& it : numbers) {
+        const auto& server = it.first.first;
+        const auto& mynym = it.first.second;
+
+        if (!reserveTransactionNumbers(server, mynym, it.second)) {
+            return -1;
+        }
+    }
+
+    const std::size_t depth =
+        "" == inflight ? DEFAULT_IN_FLIGHT : std::stoul(inflight);
+    const std::size_t step = std::max<std::size_t>(transfers.size() / 10, 1);
+    const auto start = std::chrono::steady_clock::now();
+    cli::Pipeline pipeline(depth);
+
+    for (const auto& transfer : transfers) {
+        pipeline.Add([&transfer]() -> bool {
+            auto task = cli::Stats::Submit([&]() {
+                return Opentxs::Client().OTX().SendTransfer(
+                    Identifier::Factory(transfer.mynym_),
+                    Identifier::Factory(transfer.server_),
+                    Identifier::Factory(transfer.myacct_),
+                    Identifier::Factory(transfer.hisacct_),
+                    transfer.value_,
+                    transfer.memo_);
+            });
+
+            return CmdBase::GetResultSuccess(
+                cli::Stats::Wait(std::get<1>(task)));
+        });
+    }
+
+    const auto failed = pipeline.Run(
+        [step](std::size_t done, std::size_t errors, std::size_t total) {
+            if (0 == done % step || done == total) {
+                cout << done << "/" << total << " sent, " << errors
+                     << " failed.\n";
+            }
+        });
+
+    // One inbox pass per source account picks up all of the transfer
+    // receipts at once.
+    set<string> processed;
+
+    for (const auto& transfer : transfers) {
+        if (false == processed.insert(transfer.myacct_).second) { continue; }
+
+        auto task = cli::Stats::Submit([&]() {
+            return Opentxs::Client().OTX().ProcessInbox(
+                Identifier::Factory(transfer.mynym_),
+                Identifier::Factory(transfer.server_),
+                Identifier::Factory(transfer.myacct_));
+        });
+
+        const auto& result = cli::Stats::Wait(std::get<1>(task));
+
+        if (false == CmdBase::GetResultSuccess(result)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error retrieving intermediary files for myacct ")(
+                transfer.myacct_)
+                .Flush();
+        }
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    if ("" == results) { results = file + ".results"; }
+
+    ofstream output(results, ios::out | ios::trunc);
+    output << "line,myacct,hisacct,amount,status\n";
+
+    for (std::size_t i = 0; i < transfers.size(); ++i) {
+        const auto& transfer = transfers[i];
+        output << transfer.line_ << "," << csvField(transfer.myacct_) << ","
+               << csvField(transfer.hisacct_) << ","
+               << csvField(transfer.amount_) << ","
+               << (pipeline.Succeeded(i) ? "ok" : "failed") << "\n";
+    }
+
+    if (!output.good()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot write ")(results)
+            .Flush();
+    }
+
+    cout << "Sent " << transfers.size() - failed << " of " << transfers.size()
+         << " transfers in " << elapsed.count() << " ms. Results written to "
+         << results << ".\n";
+
+    return 0 == failed ? 1 : -1;
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdTxNumbers.hpp"
+
+#include "TransactionNumberPool.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#define OT_METHOD "opentxs::CmdTxNumbers::"
+
+using namespace opentxs;
+using namespace std;
+
+CmdTxNumbers::CmdTxNumbers()
+{
+    command = "txnumbers";
+    args[0] = "--server <server>";
+    args[1] = "--mynym <nym>";
+    args[2] = "[--reserve <count>]";
+    args[3] = "[--low <count> (default 10)]";
+    args[4] = "[--high <count> (default 50)]";
+    category = catAdmin;
+    help = "Show or reserve mynym's transaction numbers on a server.";
+    usage = "Without options, shows how many transaction numbers are\n"
+            "available. --reserve waits until at least that many are.\n"
+            "Once a nym has reserved numbers (or --low/--high are given),\n"
+            "they are topped up in the background, back to --high,\n"
+            "whenever fewer than --low are left.";
+}
+
+CmdTxNumbers::~CmdTxNumbers() {}
+
+int32_t CmdTxNumbers::runWithOptions()
+{
+    return run(
+        getOption("server"),
+        getOption("mynym"),
+        getOption("reserve"),
+        getOption("low"),
+        getOption("high"));
+}
+
+int32_t CmdTxNumbers::run(
+    string server,
+    string mynym,
+    string reserve,
+    string low,
+    string high)
+{
+    if (!checkServer("server", server)) { return -1; }
+
+    if (!checkNym("mynym", mynym)) { return -1; }
+
+    if ("" != reserve && !checkValue("reserve", reserve)) { return -1; }
+
+    if ("" != low && !checkValue("low", low)) { return -1; }
+
+    if ("" != high && !checkValue("high", high)) { return -1; }
+
+    auto& pool = Opentxs::Numbers();
+
+    if ("" != low || "" != high) {
+        cli::TransactionNumberPool::Watermarks marks{};
+
+        if (!pool.Watching(server, mynym, marks)) {
+            marks.low_ = cli::TransactionNumberPool::DEFAULT_LOW_WATERMARK;
+            marks.high_ = cli::TransactionNumberPool::DEFAULT_HIGH_WATERMARK;
+        }
+
+        if ("" != low) { marks.low_ = stoul(low); }
+
+        if ("" != high) { marks.high_ = stoul(high); }
+
+        if (marks.high_ < marks.low_) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: high must not be less than low.")
+                .Flush();
+            return -1;
+        }
+
+        pool.Watch(server, mynym, marks.low_, marks.high_);
+    }
+
+    if ("" != reserve) {
+        const auto start = chrono::steady_clock::now();
+
+        if (!pool.Reserve(server, mynym, stoul(reserve))) { return -1; }
+
+        const auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start);
+        cout << "Reserved in " << elapsed.count() << " ms.\n";
+    }
+
+    cout << "Available: " << pool.Available(server, mynym) << "\n";
+
+    cli::TransactionNumberPool::Watermarks marks{};
+
+    if (pool.Watching(server, mynym, marks)) {
+        cout << "Topped up to " << marks.high_ << " below " << marks.low_
+             << ".\n";
+    }
+
+    return 1;
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdVerifySigs.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdVerifySigs::"
+
+using namespace opentxs;
+using namespace std;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+struct Signed {
+    string name_;
+    string signer_;
+    const char* status_{"unverified"};
+};
+}  // namespace
+
+CmdVerifySigs::CmdVerifySigs()
+{
+    command = "verifysigs";
+    args[0] = "--dir <directory>";
+    args[1] = "[--hisnym <nym>]";
+    args[2] = "[--signers <csvfile>]";
+    args[3] = "[--threads <threads> (default one per core)]";
+    args[4] = "[--results <csvfile> (default stdout)]";
+    category = catAdmin;
+    help = "Verify the signatures on every contract in a directory.";
+    usage = "Each file in the directory is verified against the nym listed\n"
+            "for it in the signers file (lines of: file,nym), or else\n"
+            "against hisnym. Writes one file,signer,status line per file,\n"
+            "where status is ok, bad, unreadable, unknown signer or no\n"
+            "signer, then the number of files verified per second. The\n"
+            "progress and that summary go to stderr unless --results is\n"
+            "given, so the CSV on stdout stays clean.";
+}
+
+CmdVerifySigs::~CmdVerifySigs() {}
+
+int32_t CmdVerifySigs::runWithOptions()
+{
+    return run(
+        getOption("dir"),
+        getOption("hisnym"),
+        getOption("signers"),
+        getOption("threads"),
+        getOption("results"));
+}
+
+int32_t CmdVerifySigs::run(
+    string dir,
+    string hisnym,
+    string signers,
+    string threads,
+    string results)
+{
+    if (!checkMandatory("dir", dir)) { return -1; }
+
+    if ("" != hisnym && !checkNym("hisnym", hisnym, false)) { return -1; }
+
+    if ("" != threads && !checkValue("threads", threads)) { return -1; }
+
+    if ("" == hisnym && "" == signers) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: specify --hisnym, --signers or both.")
+            .Flush();
+        return -1;
+    }
+
+    map<string, string> signerOf;
+
+    if ("" != signers) {
+        CsvRows rows;
+
+        if (!loadCsv("signers", signers, 2, rows)) { return -1; }
+
+        for (const auto& row : rows) {
+            if (2 > row.second.size()) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(": Error: line ")(
+                    row.first)(": expected file,nym.")
+                    .Flush();
+                return -1;
+            }
+
+            signerOf[row.second[0]] = row.second[1];
+        }
+    }
+
+    error_code error;
+    vector<Signed> files;
+
+    for (fs::directory_iterator it(dir, error), end; !error && it != end;
+         it.increment(error)) {
+        if (it->is_regular_file(error)) {
+            files.emplace_back();
+            files.back().name_ = it->path().filename().string();
+        }
+    }
+
+    if (error) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Error: dir: cannot list ")(dir)(
+            ": ")(error.message())
+            .Flush();
+        return -1;
+    }
+
+    if (files.empty()) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": The directory is empty.")
+            .Flush();
+        return 0;
+    }
+
+    sort(files.begin(), files.end(), [](const Signed& lhs, const Signed& rhs) {
+        return lhs.name_ < rhs.name_;
+    });
+
+    // Loading a signer's credentials is the expensive part of a
+    // verification, and the wallet keeps every nym it loads. Loading each
+    // signer once up front means the workers only ever find them cached,
+    // and files whose signer can't be loaded aren't read at all.
+    map<string, bool> loaded;
+    auto& wallet = Opentxs::Client().Wallet();
+    cli::Pipeline pipeline(
+        "" == threads ? max<size_t>(thread::hardware_concurrency(), 1)
+                      : stoul(threads));
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto& file = files[i];
+        const auto found = signerOf.find(file.name_);
+        file.signer_ = (signerOf.end() == found) ? hisnym : found->second;
+
+        if ("" == file.signer_) {
+            file.status_ = "no signer";
+            continue;
+        }
+
+        if (0 == loaded.count(file.signer_)) {
+            loaded[file.signer_] =
+                nullptr != wallet.Nym(Identifier::Factory(file.signer_));
+        }
+
+        if (false == loaded[file.signer_]) {
+            file.status_ = "unknown signer";
+            continue;
+        }
+
+        pipeline.Add([&, i]() -> bool {
+            auto& item = files[i];
+            ifstream input(fs::path(dir) / item.name_, ios::binary);
+            const string contract(
+                (istreambuf_iterator<char>(input)),
+                istreambuf_iterator<char>());
+
+            if (input.bad() || contract.empty()) {
+                item.status_ = "unreadable";
+                return false;
+            }
+
+            const bool verified =
+                SwigWrap::VerifySignature(item.signer_, contract);
+            item.status_ = verified ? "ok" : "bad";
+
+            return verified;
+        });
+    }
+
+    // Without --results the CSV goes to stdout, so keep the progress and
+    // the summary out of it.
+    ostream& progress = ("" == results) ? cerr : cout;
+    const auto start = chrono::steady_clock::now();
+    const auto step = max<size_t>(pipeline.size() / 10, 1);
+    pipeline.Run([&progress, step](size_t done, size_t errors, size_t total) {
+        if (0 == done % step || done == total) {
+            progress << done << "/" << total << " verified, " << errors
+                 << " failed.\n";
+        }
+    });
+    const auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - start);
+
+    ofstream output;
+
+    if ("" != results) {
+        output.open(results, ios::out | ios::trunc);
+
+        if (!output.good()) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Error: cannot write ")(
+                results)
+                .Flush();
+            return -1;
+        }
+    }
+
+    ostream& out = ("" == results) ? cout : output;
+    size_t passed{0};
+    out << "file,signer,status\n";
+
+    for (const auto& file : files) {
+        out << csvField(file.name_) << "," << csvField(file.signer_) << ","
+            << file.status_ << "\n";
+
+        if (string("ok") == file.status_) { ++passed; }
+    }
+
+    const double seconds = static_cast<double>(elapsed.count()) / 1000.0;
+    progress << "Verified " << passed << " of " << files.size()
+             << " files in " << elapsed.count() << " ms";
+
+    if (0 < seconds) {
+        progress << " (" << pipeline.size() / seconds << "/s)";
+    }
+
+    progress << ".\n";
+
+    return passed == files.size() ? 1 : -1;
+}
@@ -0,0 +1,33 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CLIENT_CMDVERIFYSIGS_HPP
+#define OPENTXS_CLIENT_CMDVERIFYSIGS_HPP
+
+#include "CmdBase.hpp"
+
+namespace opentxs
+{
+
+class CmdVerifySigs : public CmdBase
+{
+public:
+    EXPORT CmdVerifySigs();
+    virtual ~CmdVerifySigs();
+
+    EXPORT int32_t
+    run(std::string dir,
+        std::string hisnym,
+        std::string signers,
+        std::string threads,
+        std::string results);
+
+protected:
+    std::int32_t runWithOptions() override;
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDVERIFYSIGS_HPP
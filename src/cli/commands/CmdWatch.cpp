@@ -0,0 +1,311 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CmdWatch.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define OT_METHOD "opentxs::CmdWatch::"
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Source {
+    string event_;
+    string endpoint_;
+    // Only set for activity thread events.
+    string thread_;
+};
+
+// Printable frames (IDs, labels) are written as JSON strings, anything else
+// (amounts, serialized protobufs) as 0x-prefixed hex.
+void write_frame(ostream& out, const network::zeromq::Frame& frame)
+{
+    const auto* data = static_cast<const unsigned char*>(frame.data());
+    const auto size = frame.size();
+    bool printable{true};
+
+    for (size_t i = 0; i < size; ++i) {
+        if ((0x20 > data[i]) || (0x7e < data[i])) {
+            printable = false;
+            break;
+        }
+    }
+
+    static const char hex[] = "0123456789abcdef";
+    out << '"';
+
+    if (printable) {
+        for (size_t i = 0; i < size; ++i) {
+            const auto c = static_cast<char>(data[i]);
+
+            if (('"' == c) || ('\\' == c)) { out << '\\'; }
+
+            out << c;
+        }
+    } else {
+        out << "0x";
+
+        for (size_t i = 0; i < size; ++i) {
+            out << hex[data[i] >> 4] << hex[data[i] & 0xf];
+        }
+    }
+
+    out << '"';
+}
+
+string format_event(
+    const Source& source,
+    const network::zeromq::Message& message)
+{
+    const auto now = chrono::duration_cast<chrono::milliseconds>(
+        chrono::system_clock::now().time_since_epoch());
+    ostringstream out;
+    out << "{\"time_ms\":" << now.count() << ",\"event\":\"" << source.event_
+        << "\"";
+
+    if (false == source.thread_.empty()) {
+        out << ",\"thread\":\"" << source.thread_ << "\"";
+    }
+
+    out << ",\"frames\":[";
+
+    for (size_t i = 0; i < message.Body().size(); ++i) {
+        if (0 < i) { out << ","; }
+
+        write_frame(out, message.Body_at(i));
+    }
+
+    out << "]}";
+
+    return out.str();
+}
+}  // namespace
+
+CmdWatch::CmdWatch()
+{
+    command = "watch";
+    args[0] = "[--mynym <nym>]";
+    args[1] = "[--events <event,...> (default all)]";
+    args[2] = "[--count <events>]";
+    args[3] = "[--duration <seconds>]";
+    category = catWallet;
+    help = "Print wallet and activity events as they happen.";
+    usage = "Prints one JSON object per line for every notification the\n"
+            "client publishes, until --count events have been printed or\n"
+            "--duration seconds have passed (by default, until stopped).\n"
+            "Events: account, workflow, contact, nym, server, peerrequest,\n"
+            "peerreply and thread. Thread events are for mynym's activity\n"
+            "threads, so they need --mynym; threads created while watching\n"
+            "are picked up and first reported with no frames.";
+}
+
+CmdWatch::~CmdWatch() {}
+
+int32_t CmdWatch::runWithOptions()
+{
+    return run(
+        getOption("mynym"),
+        getOption("events"),
+        getOption("count"),
+        getOption("duration"));
+}
+
+int32_t CmdWatch::run(
+    string mynym,
+    string events,
+    string count,
+    string duration)
+{
+    if ("" != mynym && !checkNym("mynym", mynym)) { return -1; }
+
+    if ("" != count && !checkValue("count", count)) { return -1; }
+
+    if ("" != duration && !checkValue("duration", duration)) { return -1; }
+
+    const auto& ot = Opentxs::Client();
+    const auto& endpoints = ot.Endpoints();
+    const map<string, string> publishers{
+        {"account", endpoints.AccountUpdate()},
+        {"contact", endpoints.ContactUpdate()},
+        {"nym", endpoints.NymDownload()},
+        {"peerreply", endpoints.PeerReplyUpdate()},
+        {"peerrequest", endpoints.PeerRequestUpdate()},
+        {"server", endpoints.ServerUpdate()},
+        {"workflow", endpoints.WorkflowAccountUpdate()}};
+    set<string> wanted;
+
+    if ("" == events) {
+        for (const auto& it : publishers) { wanted.insert(it.first); }
+
+        if ("" != mynym) { wanted.insert("thread"); }
+    } else {
+        for (const auto& event : tokenize(events, ',', true)) {
+            if ((0 == publishers.count(event)) && ("thread" != event)) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(
+                    ": Error: unknown event: ")(event)(".")
+                    .Flush();
+                return -1;
+            }
+
+            wanted.insert(event);
+        }
+    }
+
+    vector<Source> sources;
+
+    for (const auto& it : publishers) {
+        if (1 == wanted.count(it.first)) {
+            sources.push_back(Source{it.first, it.second, ""});
+        }
+    }
+
+    const bool watchThreads = 1 == wanted.count("thread");
+
+    if (watchThreads && ("" == mynym)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Error: thread events need --mynym.")
+            .Flush();
+        return -1;
+    }
+
+    const size_t limit = "" == count ? 0 : stoul(count);
+    mutex lock;
+    condition_variable printed;
+    size_t received{0};
+    bool rescan{false};
+    const auto done = [&]() -> bool { return 0 < limit && received >= limit; };
+    const auto print = [&](const string& line) -> void {
+        lock_guard<mutex> guard(lock);
+
+        if (done()) { return; }
+
+        // endl, so a consumer on the other end of a pipe sees each event as
+        // soon as it happens.
+        cout << line << endl;
+        ++received;
+        printed.notify_all();
+    };
+    list<OTZMQListenCallback> callbacks;
+    list<OTZMQSubscribeSocket> sockets;
+    const auto subscribe = [&](const string& endpoint) -> bool {
+        sockets.emplace_back(ot.ZeroMQ().SubscribeSocket(callbacks.back()));
+
+        if (false == sockets.back()->Start(endpoint)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(
+                ": Error: cannot subscribe to ")(endpoint)(".")
+                .Flush();
+            return false;
+        }
+
+        return true;
+    };
+    const auto watch = [&](const Source& source) -> bool {
+        callbacks.emplace_back(network::zeromq::ListenCallback::Factory(
+            [&, source](const network::zeromq::Message& message) -> void {
+                print(format_event(source, message));
+            }));
+
+        return subscribe(source.endpoint_);
+    };
+
+    for (const auto& source : sources) {
+        if (false == watch(source)) { return -1; }
+    }
+
+    // Threads only publish on their own endpoints, so new ones are found
+    // through the activity summary, which changes whenever a thread is
+    // added. The summary callback only flags a rescan; sockets are opened
+    // on this thread.
+    const auto nymID = Identifier::Factory(mynym);
+    set<string> threads;
+    const auto scan = [&](bool announce) -> bool {
+        for (const auto& thread : ot.Activity().Threads(nymID, false)) {
+            if (false == threads.insert(thread.first).second) { continue; }
+
+            const Source source{
+                "thread", endpoints.ThreadUpdate(thread.first), thread.first};
+
+            if (false == watch(source)) { return false; }
+
+            // The update that created the thread went out before there was
+            // a socket to hear it, so report it as an event without frames.
+            if (announce) {
+                const auto empty = network::zeromq::Message::Factory();
+                print(format_event(source, empty));
+            }
+        }
+
+        return true;
+    };
+
+    if (watchThreads) {
+        const auto widget = ot.UI().ActivitySummary(nymID).WidgetID().str();
+        callbacks.emplace_back(network::zeromq::ListenCallback::Factory(
+            [&, widget](const network::zeromq::Message& message) -> void {
+                if (0 == message.Body().size()) { return; }
+
+                if (widget != string(message.Body_at(0))) { return; }
+
+                lock_guard<mutex> guard(lock);
+                rescan = true;
+                printed.notify_all();
+            }));
+
+        if (false == subscribe(endpoints.WidgetUpdate())) { return -1; }
+
+        if (false == scan(false)) { return -1; }
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Watching ")(sources.size())(
+        " publishers and ")(threads.size())(" threads.")
+        .Flush();
+
+    bool scanned{true};
+
+    {
+        const auto deadline =
+            chrono::steady_clock::now() +
+            chrono::seconds("" == duration ? 0 : stoul(duration));
+        const auto wake = [&]() -> bool { return done() || rescan; };
+        unique_lock<mutex> guard(lock);
+
+        while (false == done()) {
+            if ("" == duration) {
+                printed.wait(guard, wake);
+            } else if (false == printed.wait_until(guard, deadline, wake)) {
+                break;
+            }
+
+            if (rescan) {
+                rescan = false;
+                // print() takes the lock.
+                guard.unlock();
+                scanned = scan(true);
+                guard.lock();
+
+                if (false == scanned) { break; }
+            }
+        }
+    }
+
+    for (auto& socket : sockets) { socket->Close(); }
+
+    return scanned ? 1 : -1;
+}
@@ -53,9 +53,11 @@ int32_t CmdWithdrawCash::withdrawCash(const string& myacct, int64_t amount)
         Opentxs::Client().Exec().GetAccountWallet_NymID(myacct))};
     const auto serverID{opentxs::identifier::Server::Factory(
         Opentxs::Client().Exec().GetAccountWallet_NotaryID(myacct))};
-    auto task = Opentxs::Client().OTX().WithdrawCash(
-        nymID, serverID, accountID, amount);
-    const auto result = std::get<1>(task).get();
+    auto task = cli::Stats::Submit([&]() {
+        return Opentxs::Client().OTX().WithdrawCash(
+            nymID, serverID, accountID, amount);
+    });
+    const auto result = cli::Stats::Wait(std::get<1>(task));
     const auto success = CmdBase::GetResultSuccess(result);
 
     if (false == success) {
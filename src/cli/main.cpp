@@ -6,6 +6,9 @@
 #include <opentxs/opentxs.hpp>
 
 #include "opentxs.hpp"
+#include "Stats.hpp"
+
+#include <memory>
 
 opentxs::Opentxs::PasswordCallback* callback_{nullptr};
 opentxs::OTCaller* password_caller_{nullptr};
@@ -24,12 +27,19 @@ int main(int argc, char* argv[])
 
     OT_ASSERT(password_caller_->isCallbackSet())
 
-    opentxs::OT::Start({}, {}, password_caller_);
-
     int returnValue{0};
     {
-        opentxs::Opentxs opentxsCLI(opentxs::OT::App().StartClient({}, 0));
-        returnValue = opentxsCLI.run(argc, argv);
+        std::unique_ptr<opentxs::Opentxs> opentxsCLI{};
+
+        {
+            // Left in the totals for the first command's --stats report.
+            opentxs::cli::Stats::Scope scope("start");
+            opentxs::OT::Start({}, {}, password_caller_);
+            opentxsCLI.reset(
+                new opentxs::Opentxs(opentxs::OT::App().StartClient({}, 0)));
+        }
+
+        returnValue = opentxsCLI->run(argc, argv);
     }
 
     opentxs::OT::Cleanup();
@@ -5,6 +5,10 @@
 
 #include "opentxs.hpp"
 
+#include "Preloader.hpp"
+#include "Stats.hpp"
+#include "Trace.hpp"
+#include "TransactionNumberPool.hpp"
 #include "commands/CmdAcceptAll.hpp"
 #include "commands/CmdAcceptInbox.hpp"
 #include "commands/CmdAcceptIncoming.hpp"
@@ -24,10 +28,13 @@
 #include "commands/CmdAddContract.hpp"
 #include "commands/CmdAddServer.hpp"
 #include "commands/CmdAddSignature.hpp"
+#include "commands/CmdAllocateAddresses.hpp"
 #include "commands/CmdAllocateBitcoinAddress.hpp"
 #include "commands/CmdArchivePeerReply.hpp"
 #include "commands/CmdAssignBitcoinAddress.hpp"
 #include "commands/CmdBase.hpp"
+#include "commands/CmdBench.hpp"
+#include "commands/CmdBenchNotary.hpp"
 #include "commands/CmdCanMessage.hpp"
 #include "commands/CmdCancel.hpp"
 #include "commands/CmdChangePw.hpp"
@@ -54,6 +61,7 @@
 #include "commands/CmdFindNym.hpp"
 #include "commands/CmdFindServer.hpp"
 #include "commands/CmdGetContact.hpp"
+#include "commands/CmdGenerateWallet.hpp"
 #include "commands/CmdGetContract.hpp"
 #include "commands/CmdGetMarkets.hpp"
 #include "commands/CmdGetMyOffers.hpp"
@@ -64,6 +72,7 @@
 #include "commands/CmdGetPeerRequests.hpp"
 #include "commands/CmdHaveContact.hpp"
 #include "commands/CmdImportCash.hpp"
+#include "commands/CmdImportContacts.hpp"
 #include "commands/CmdImportNym.hpp"
 #include "commands/CmdImportOtherNym.hpp"
 #include "commands/CmdImportPublicNym.hpp"
@@ -72,6 +81,7 @@
 #include "commands/CmdInpayments.hpp"
 #include "commands/CmdIssueAsset.hpp"
 #include "commands/CmdKillOffer.hpp"
+#include "commands/CmdKillOffers.hpp"
 #include "commands/CmdKillPlan.hpp"
 #include "commands/CmdMarkRead.hpp"
 #include "commands/CmdMarkUnRead.hpp"
@@ -83,6 +93,7 @@
 #include "commands/CmdNewKey.hpp"
 #include "commands/CmdNewNymHD.hpp"
 #include "commands/CmdNewNymLegacy.hpp"
+#include "commands/CmdNewNyms.hpp"
 #include "commands/CmdNewOffer.hpp"
 #include "commands/CmdNotifyBailment.hpp"
 #include "commands/CmdOutbox.hpp"
@@ -95,6 +106,7 @@
 #include "commands/CmdPayInvoice.hpp"
 #include "commands/CmdPeerStoreSecret.hpp"
 #include "commands/CmdPingNotary.hpp"
+#include "commands/CmdPreload.hpp"
 #include "commands/CmdPreloadActivity.hpp"
 #include "commands/CmdPreloadThread.hpp"
 #include "commands/CmdProposePlan.hpp"
@@ -154,11 +166,15 @@
 #include "commands/CmdStartIntroductionServer.hpp"
 #include "commands/CmdStartServer.hpp"
 #include "commands/CmdTransfer.hpp"
+#include "commands/CmdTransfers.hpp"
 #include "commands/CmdTriggerClause.hpp"
+#include "commands/CmdTxNumbers.hpp"
 #include "commands/CmdUsageCredits.hpp"
 #include "commands/CmdVerifyPassword.hpp"
 #include "commands/CmdVerifyReceipt.hpp"
 #include "commands/CmdVerifySignature.hpp"
+#include "commands/CmdVerifySigs.hpp"
+#include "commands/CmdWatch.hpp"
 #include "commands/CmdWithdrawCash.hpp"
 #include "commands/CmdWithdrawVoucher.hpp"
 #include "commands/CmdWriteCheque.hpp"
@@ -175,6 +191,7 @@ extern "C" {
 #include <stdint.h>
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -199,6 +216,24 @@ const opentxs::api::client::Manager& Opentxs::Client()
     return *client_;
 }
 
+cli::TransactionNumberPool* Opentxs::numbers_{nullptr};
+
+cli::TransactionNumberPool& Opentxs::Numbers()
+{
+    OT_ASSERT(nullptr != numbers_);
+
+    return *numbers_;
+}
+
+cli::Preloader* Opentxs::preload_{nullptr};
+
+cli::Preloader& Opentxs::Preload()
+{
+    OT_ASSERT(nullptr != preload_);
+
+    return *preload_;
+}
+
 bool Opentxs::PasswordCallback::get_password(
     OTPassword& output,
     const char* prompt) const
@@ -371,9 +406,12 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdAddContract,
             new CmdAddServer,
             new CmdAddSignature,
+            new CmdAllocateAddresses,
             new CmdAllocateBitcoinAddress,
             new CmdArchivePeerReply,
             new CmdAssignBitcoinAddress,
+            new CmdBench,
+            new CmdBenchNotary,
             new CmdCancel,
             new CmdCanMessage,
             new CmdChangePw,
@@ -399,6 +437,7 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdExportNym,
             new CmdFindNym,
             new CmdFindServer,
+            new CmdGenerateWallet,
             new CmdGetContact,
             new CmdGetInstrumentDefinition,
             new CmdGetMarkets,
@@ -410,6 +449,7 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdGetPeerReply,
             new CmdHaveContact,
             new CmdImportCash,
+            new CmdImportContacts,
             new CmdImportNym,
             new CmdImportPublicNym,
             new CmdImportSeed,
@@ -417,6 +457,7 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdInpayments,
             new CmdIssueAsset,
             new CmdKillOffer,
+            new CmdKillOffers,
             new CmdKillPlan,
             new CmdMarkRead,
             new CmdMarkUnRead,
@@ -427,6 +468,7 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdNewKey,
             new CmdNewNymHD,
             new CmdNewNymLegacy,
+            new CmdNewNyms,
             new CmdNewOffer,
             new CmdNotifyBailment,
             new CmdImportOtherNym,
@@ -441,6 +483,7 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdPayInvoice,
             new CmdPeerStoreSecret,
             new CmdPingNotary,
+            new CmdPreload,
             new CmdPreloadActivity,
             new CmdPreloadThread,
             new CmdProposePlan,
@@ -500,11 +543,15 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
             new CmdStartIntroductionServer,
             new CmdStartServer,
             new CmdTransfer,
+            new CmdTransfers,
             new CmdTriggerClause,
+            new CmdTxNumbers,
             new CmdUsageCredits,
             new CmdVerifyPassword,
             new CmdVerifyReceipt,
             new CmdVerifySignature,
+            new CmdVerifySigs,
+            new CmdWatch,
             new CmdWithdrawCash,
             new CmdWithdrawVoucher,
             new CmdWriteCheque,
@@ -513,9 +560,23 @@ Opentxs::Opentxs(const opentxs::api::client::Manager& client)
     OT_ASSERT(nullptr == client_);
 
     client_ = &client;
+    numbers_ = new cli::TransactionNumberPool(client);
+
+    OT_ASSERT(nullptr != numbers_);
+
+    preload_ = new cli::Preloader(client);
+
+    OT_ASSERT(nullptr != preload_);
 }
 
-Opentxs::~Opentxs() {}
+Opentxs::~Opentxs()
+{
+    // Stop the background threads while the client is still running.
+    delete preload_;
+    preload_ = nullptr;
+    delete numbers_;
+    numbers_ = nullptr;
+}
 
 string& Opentxs::ltrim(string& s)
 {
@@ -586,6 +647,9 @@ void Opentxs::loadOptions(AnyOption& opt)
     opt.setCommandFlag("noprompt");
     opt.setCommandFlag("dummy-passphrase");
     opt.setCommandFlag("test");
+    opt.setCommandFlag("nopreload");
+    opt.setCommandFlag("stats");
+    opt.setCommandFlag("stats-json");
 
     opt.setCommandOption("args");
     opt.setCommandOption("myacct");
@@ -595,6 +659,7 @@ void Opentxs::loadOptions(AnyOption& opt)
     opt.setCommandOption("hisnym");
     opt.setCommandOption("hispurse");
     opt.setCommandOption("server");
+    opt.setCommandOption("trace");
 
     // for options that will be checked only from the CLI option file
     opt.setFileOption("defaultserver");
@@ -718,7 +783,10 @@ int Opentxs::processCommand(AnyOption& opt)
 
 int Opentxs::run(int argc, char* argv[])
 {
-    Opentxs::Client().OTAPI().LoadWallet();
+    {
+        cli::Stats::Scope scope("loadwallet");
+        Opentxs::Client().OTAPI().LoadWallet();
+    }
 
     map<string, string> macros;
     vector<int> errorLineNumbers;
@@ -737,6 +805,9 @@ int Opentxs::run(int argc, char* argv[])
         return processCommand(opt);
     }
 
+    // Warm the caches while the user types the first command.
+    if (!opt.getFlag("nopreload")) { Preload().Start({}); }
+
     int lineNumber = 0;
     bool echoCommand = opt.getFlag("echocommand") || opt.getFlag("test");
     bool echoExpand = opt.getFlag("echoexpand") || opt.getFlag("test");
@@ -1008,17 +1079,30 @@ int Opentxs::run(int argc, char* argv[])
 
 int Opentxs::runCommand(CmdBase& cmd)
 {
+    const auto start = std::chrono::steady_clock::now();
     auto argNames = cmd.extractArgumentNames();
 
     AnyOption options;
-    for (size_t i = 0; i < argNames.size(); i++) {
-        if (!options.findOption(argNames[i].c_str())) {
-            options.setCommandOption(argNames[i].c_str());
+
+    {
+        cli::Stats::Scope scope("options");
+
+        for (size_t i = 0; i < argNames.size(); i++) {
+            if (!options.findOption(argNames[i].c_str())) {
+                options.setCommandOption(argNames[i].c_str());
+            }
         }
+
+        loadOptions(options);
+        options.processCommandArgs(newArgc, newArgv);
     }
 
-    loadOptions(options);
-    options.processCommandArgs(newArgc, newArgv);
+    const char* trace = options.getValue("trace");
+
+    if (nullptr != trace) {
+        cli::Trace::Start(start);
+        cli::Trace::Span("options", start, std::chrono::steady_clock::now());
+    }
 
     map<string, string> arguments;
     for (size_t i = 0; i < argNames.size(); i++) {
@@ -1049,7 +1133,31 @@ int Opentxs::runCommand(CmdBase& cmd)
         }
     }
 
+    const auto begin = std::chrono::steady_clock::now();
     bool success = cmd.run(arguments);
+
+    if (nullptr != trace) {
+        cli::Trace::Span(
+            cmd.getCommand(), begin, std::chrono::steady_clock::now());
+
+        if (cli::Trace::Stop(trace)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Wrote trace to ")(trace)
+                .Flush();
+        }
+    }
+
+    const bool json = options.getFlag("stats-json");
+
+    if (json || options.getFlag("stats")) {
+        cli::Stats::Write(
+            std::cerr,
+            cmd.getCommand(),
+            std::chrono::steady_clock::now() - start,
+            json);
+    }
+
+    cli::Stats::Reset();
+
     if (!success && !expectFailure) {
         cout << cmd.getUsage();
     } else {
@@ -19,10 +19,18 @@ namespace opentxs
 
 class CmdBase;
 
+namespace cli
+{
+class Preloader;
+class TransactionNumberPool;
+}  // namespace cli
+
 class Opentxs
 {
 public:
     static const opentxs::api::client::Manager& Client();
+    static cli::TransactionNumberPool& Numbers();
+    static cli::Preloader& Preload();
 
     class PasswordCallback : virtual public OTCallback
     {
@@ -57,6 +65,8 @@ private:
     const std::string spaces24 = "                        ";
 
     static const opentxs::api::client::Manager* client_;
+    static cli::TransactionNumberPool* numbers_;
+    static cli::Preloader* preload_;
 
     int newArgc{0};
     char** newArgv{nullptr};